@@ -45,37 +45,823 @@ struct BlockInfo BlockAnalysis_close(struct BlockAnalysis *ba)
     return bi;
 }
 
-struct CodeAnalysis analyze(enum evmc_revision rev, uint8_t* code, size_t code_size)
+#define i_val struct SelectorSlot
+#define i_opt c_no_cmp
+#define i_tag slot
+#include "../stc/cvec.h"
+
+#define i_val struct Superblock
+#define i_opt c_no_cmp
+#define i_tag superblock
+#include "../stc/cvec.h"
+
+/// The working storage of analyze(), kept between the calls so its capacity is reused.
+/// The finished analysis is copied out of it into an arena of the exact size. A lazy
+/// analysis has a scratch storage of its own, it keeps growing with the code reached.
+struct AnalysisScratch
 {
-    OpTable op_tbl = get_op_table(rev);
-    instruction_exec_fn opx_beginblock_fn = op_tbl.table[OPX_BEGINBLOCK].fn;
+    bool initialized;
 
-    struct CodeAnalysis analysis;
-    CodeAnalysis_init(&analysis);
+    cvec_instr instrs;
+    cvec_uint8 opcodes;
+    cvec_u256 push_values;
+    cvec_int32 jumpdest_offsets;
+    cvec_int32 jumpdest_targets;
+    cvec_slot selector_slots;
+    cvec_superblock superblocks;
+
+    /// The index of the BEGINBLOCK and the stack height change of every block, in code order.
+    cvec_int32 block_begins;
+    cvec_int32 block_stack_changes;
+
+    /// The open addressing table of the push_values indexes, -1 for the empty slots.
+    cvec_int32 push_value_slots;
+};
+
+struct AnalysisScratch analysis_scratch;
+
+void AnalysisScratch_init(struct AnalysisScratch *scratch)
+{
+    scratch->instrs = cvec_instr_init();
+    scratch->opcodes = cvec_uint8_init();
+    scratch->push_values = cvec_u256_init();
+    scratch->jumpdest_offsets = cvec_int32_init();
+    scratch->jumpdest_targets = cvec_int32_init();
+    scratch->selector_slots = cvec_slot_init();
+    scratch->superblocks = cvec_superblock_init();
+    scratch->block_begins = cvec_int32_init();
+    scratch->block_stack_changes = cvec_int32_init();
+    scratch->push_value_slots = cvec_int32_init();
+    scratch->initialized = true;
+}
+
+/// Releases the scratch storage of a lazy analysis.
+void AnalysisScratch_free(struct AnalysisScratch *scratch)
+{
+    cvec_instr_drop(&scratch->instrs);
+    cvec_uint8_drop(&scratch->opcodes);
+    cvec_u256_drop(&scratch->push_values);
+    cvec_int32_drop(&scratch->jumpdest_offsets);
+    cvec_int32_drop(&scratch->jumpdest_targets);
+    cvec_slot_drop(&scratch->selector_slots);
+    cvec_superblock_drop(&scratch->superblocks);
+    cvec_int32_drop(&scratch->block_begins);
+    cvec_int32_drop(&scratch->block_stack_changes);
+    cvec_int32_drop(&scratch->push_value_slots);
+    free(scratch);
+}
+
+/// The number of bytes allocated for the scratch storage.
+size_t AnalysisScratch_size(struct AnalysisScratch *scratch)
+{
+    return sizeof(struct AnalysisScratch) +
+           cvec_instr_capacity(scratch->instrs) * sizeof(struct Instruction) +
+           cvec_uint8_capacity(scratch->opcodes) +
+           cvec_u256_capacity(scratch->push_values) * sizeof(struct uint256_t) +
+           (cvec_int32_capacity(scratch->jumpdest_offsets) + cvec_int32_capacity(scratch->jumpdest_targets)) * sizeof(int32_t) +
+           cvec_slot_capacity(scratch->selector_slots) * sizeof(struct SelectorSlot) +
+           cvec_superblock_capacity(scratch->superblocks) * sizeof(struct Superblock) +
+           (cvec_int32_capacity(scratch->block_begins) + cvec_int32_capacity(scratch->block_stack_changes) +
+            cvec_int32_capacity(scratch->push_value_slots)) * sizeof(int32_t);
+}
+
+/// Returns the scratch storage emptied and reserved for the analysis of code_size bytes.
+struct AnalysisScratch *AnalysisScratch_get(size_t code_size)
+{
+    struct AnalysisScratch *scratch = &analysis_scratch;
+    if (!scratch->initialized)
+        AnalysisScratch_init(scratch);
+    cvec_instr_clear(&scratch->instrs);
+    cvec_uint8_clear(&scratch->opcodes);
+    cvec_u256_clear(&scratch->push_values);
+    cvec_int32_clear(&scratch->jumpdest_offsets);
+    cvec_int32_clear(&scratch->jumpdest_targets);
+    cvec_slot_clear(&scratch->selector_slots);
+    cvec_superblock_clear(&scratch->superblocks);
+    cvec_int32_clear(&scratch->block_begins);
+    cvec_int32_clear(&scratch->block_stack_changes);
+    cvec_int32_clear(&scratch->push_value_slots);
+
+    cvec_instr_reserve(&scratch->instrs, code_size + 1);
+    cvec_uint8_reserve(&scratch->opcodes, code_size + 1);
+
+    // Every PUSH9-PUSH32 takes at least 10 bytes of code, except a truncated one at the end.
+    // The values folded by fold_constants() come on top, the pool grows for them, see
+    // AnalysisScratch_grow_push_values().
+    size_t max_push_values = code_size / 10 + 1;
+    cvec_u256_reserve(&scratch->push_values, max_push_values);
+    size_t slots = 1;
+    while (slots < 2 * max_push_values)
+        slots *= 2;
+    cvec_int32_resize(&scratch->push_value_slots, slots, -1);
+    return scratch;
+}
+
+/// Returns the analysis being built in the scratch storage, finding the jump destinations by
+/// binary search. It is valid until instructions are added to the scratch storage.
+struct CodeAnalysis AnalysisScratch_view(struct AnalysisScratch *scratch, size_t code_size)
+{
+    struct CodeAnalysis view;
+    memset(&view, 0, sizeof(view));
+    view.instrs = cvec_instr_begin(&scratch->instrs).ref;
+    view.instrs_size = cvec_instr_size(scratch->instrs);
+    view.opcodes = cvec_uint8_begin(&scratch->opcodes).ref;
+    view.jumpdest_offsets = cvec_int32_begin(&scratch->jumpdest_offsets).ref;
+    view.jumpdest_targets = cvec_int32_begin(&scratch->jumpdest_targets).ref;
+    view.jumpdests_size = cvec_int32_size(scratch->jumpdest_offsets);
+    view.jumpdest_index = JUMPDEST_INDEX_SEARCH;
+    view.code_size = (int)code_size;
+    return view;
+}
+
+/// Closes the current block of analyze(): writes its BlockInfo and records it for form_superblocks().
+void AnalysisScratch_close_block(struct AnalysisScratch *scratch, struct BlockAnalysis *block)
+{
+    cvec_instr_at_mut(&scratch->instrs, block->begin_block_index)->arg.block = BlockAnalysis_close(block);
+    cvec_int32_push(&scratch->block_begins, (int32_t)block->begin_block_index);
+    cvec_int32_push(&scratch->block_stack_changes, block->stack_change);
+}
+
+/// Returns the first slot of the value in AnalysisScratch::push_value_slots, a table of mask + 1 slots.
+size_t push_value_slot(const struct uint256_t *value, size_t mask)
+{
+    uint64_t hash = (WORD_P(value, 0) ^ (WORD_P(value, 1) * 0x9e3779b97f4a7c15ULL) ^
+                     (WORD_P(value, 2) * 0xc2b2ae3d27d4eb4fULL) ^ (WORD_P(value, 3) * 0x165667b19e3779f9ULL)) * 0xff51afd7ed558ccdULL;
+    return (size_t)(hash >> 32) & mask;
+}
+
+/// Doubles the capacity of the constant pool and rehashes it. The pushes analyzed so far are
+/// pointed into the new storage, all but the last instruction: the push being analyzed.
+void AnalysisScratch_grow_push_values(struct AnalysisScratch *scratch)
+{
+    size_t size = cvec_instr_size(scratch->instrs) - 1;
+    struct Instruction *instrs = cvec_instr_begin(&scratch->instrs).ref;
+    const uint8_t *ops = cvec_uint8_begin(&scratch->opcodes).ref;
+
+    const struct uint256_t *pool = cvec_u256_begin(&scratch->push_values).ref;
+    for (size_t i = 0; i < size; ++i)
+        if (ops[i] >= OP_PUSH9 && ops[i] <= OP_PUSH32)
+            instrs[i].arg.number = instrs[i].arg.push_value - pool;
+    cvec_u256_reserve(&scratch->push_values, max(2 * cvec_u256_capacity(scratch->push_values), (size_t)16));
+    struct uint256_t *grown = cvec_u256_begin(&scratch->push_values).ref;
+    for (size_t i = 0; i < size; ++i)
+        if (ops[i] >= OP_PUSH9 && ops[i] <= OP_PUSH32)
+            instrs[i].arg.push_value = grown + instrs[i].arg.number;
+
+    size_t slots_size = 1;
+    while (slots_size < 2 * cvec_u256_capacity(scratch->push_values))
+        slots_size *= 2;
+    cvec_int32_clear(&scratch->push_value_slots);
+    cvec_int32_resize(&scratch->push_value_slots, slots_size, -1);
+    int32_t *slots = cvec_int32_begin(&scratch->push_value_slots).ref;
+    for (size_t v = 0; v < cvec_u256_size(scratch->push_values); ++v)
+    {
+        size_t slot = push_value_slot(&grown[v], slots_size - 1);
+        while (slots[slot] >= 0)
+            slot = (slot + 1) & (slots_size - 1);
+        slots[slot] = (int32_t)v;
+    }
+}
+
+/// Returns the constant pool entry of the value, added if not in the pool yet.
+/// Solidity code repeats a few large constants, e.g. the address mask, over and over.
+struct uint256_t *AnalysisScratch_push_value(struct AnalysisScratch *scratch, struct uint256_t *value)
+{
+    if (cvec_u256_size(scratch->push_values) == cvec_u256_capacity(scratch->push_values))
+        AnalysisScratch_grow_push_values(scratch);
+
+    size_t mask = cvec_int32_size(scratch->push_value_slots) - 1;
+    int32_t *slots = cvec_int32_begin(&scratch->push_value_slots).ref;
+    struct uint256_t *pool = cvec_u256_begin(&scratch->push_values).ref;
+
+    for (size_t slot = push_value_slot(value, mask);; slot = (slot + 1) & mask)
+    {
+        if (slots[slot] < 0)
+        {
+            slots[slot] = (int32_t)cvec_u256_size(scratch->push_values);
+            return cvec_u256_push(&scratch->push_values, *value);
+        }
+        if (equal256(&pool[slots[slot]], value))
+            return &pool[slots[slot]];
+    }
+}
+
+/// Replaces the last instructions with a single superinstruction if they form one of the
+/// sequences the Solidity compiler emits over and over.
+///
+/// Only instructions after the current block's BEGINBLOCK are considered, so no jump can land
+/// inside a fused sequence. The base gas and the stack requirements of the original
+/// instructions have already been accounted to the block, so the fused handlers only need
+/// to have the same effect on the stack and memory. The jumps are fused only if static_jumps,
+/// their targets have to be resolved once all JUMPDESTs are known.
+/// Returns the number of instructions eliminated.
+int fuse_instructions(struct AnalysisScratch *analysis, size_t block_begin, bool static_jumps)
+{
+    size_t size = cvec_uint8_size(analysis->opcodes);
+    const uint8_t *ops = cvec_uint8_begin(&analysis->opcodes).ref;
+    struct Instruction *instrs = cvec_instr_begin(&analysis->instrs).ref;
+
+    struct Instruction fused;
+    uint8_t fused_opcode;
+    size_t fused_size;
+
+#define TAIL(n) (size - 1 - block_begin > (n) ? ops[size - 1 - (n)] : OPX_BEGINBLOCK)
+    if (TAIL(0) == OP_AND && TAIL(1) == OP_PUSH20 &&
+        WORD_P(instrs[size - 2].arg.push_value, 3) == 0 && WORD_P(instrs[size - 2].arg.push_value, 2) == 0xffffffff &&
+        WORD_P(instrs[size - 2].arg.push_value, 1) == UINT64_MAX && WORD_P(instrs[size - 2].arg.push_value, 0) == UINT64_MAX)
+    {
+        Instrcution_init_v(&fused, opx_and_address);
+        fused_opcode = OPX_AND_ADDRESS;
+        fused_size = 2;
+    }
+    else if (TAIL(0) == OP_MLOAD && TAIL(1) == OP_PUSH1)
+    {
+        Instrcution_init_v(&fused, opx_push_mload);
+        fused.arg.small_push_value = instrs[size - 2].arg.small_push_value;
+        fused_opcode = OPX_PUSH_MLOAD;
+        fused_size = 2;
+    }
+    else if (TAIL(0) == OP_ISZERO && TAIL(1) == OP_ISZERO)
+    {
+        Instrcution_init_v(&fused, opx_iszero_iszero);
+        fused_opcode = OPX_ISZERO_ISZERO;
+        fused_size = 2;
+    }
+    else if (static_jumps && TAIL(0) == OP_JUMPI && TAIL(1) == OP_PUSH2 && TAIL(2) == OP_EQ && TAIL(3) == OP_PUSH4 && TAIL(4) == OP_DUP1)
+    {
+        Instrcution_init_v(&fused, opx_selector_jumpi);
+        fused.arg.selector_jump.selector = (uint32_t)instrs[size - 4].arg.small_push_value;
+        fused.arg.selector_jump.dest = (int32_t)instrs[size - 2].arg.small_push_value;
+        fused_opcode = OPX_SELECTOR_JUMPI;
+        fused_size = 5;
+    }
+    else if (static_jumps && (TAIL(0) == OP_JUMP || TAIL(0) == OP_JUMPI) && TAIL(1) >= OP_PUSH1 && TAIL(1) <= OP_PUSH8)
+    {
+        // The target is resolved by resolve_static_jumps() once all JUMPDESTs are known.
+        bool conditional = TAIL(0) == OP_JUMPI;
+        uint64_t dest = instrs[size - 2].arg.small_push_value;
+        Instrcution_init_v(&fused, conditional ? opx_static_jumpi : opx_static_jump);
+        fused.arg.number = dest <= INT_MAX ? (int64_t)dest : -1;
+        fused_opcode = conditional ? OPX_STATIC_JUMPI : OPX_STATIC_JUMP;
+        fused_size = 2;
+    }
+    else
+        return 0;
+#undef TAIL
+
+    for (size_t i = 0; i < fused_size; ++i)
+    {
+        cvec_instr_pop(&analysis->instrs);
+        cvec_uint8_pop(&analysis->opcodes);
+    }
+    cvec_instr_push(&analysis->instrs, fused);
+    cvec_uint8_push(&analysis->opcodes, fused_opcode);
+    return (int)fused_size - 1;
+}
+
+/// The instructions fold_constants() evaluates at analysis time: the pure ones of the STACK
+/// kind, run by the very implementation the interpreters use.
+#define FOLD_STACK(opcode, impl) [opcode] = impl,
+#define FOLD_STATE(opcode, impl)
+#define FOLD_STATUS(opcode, impl)
+#define FOLD_GAS_CORRECTION(opcode, impl)
+#define FOLD_CUSTOM(opcode, impl)
+
+static void (*const fold_fns[256])(struct StackTop) = {
+#define X(opcode, identifier, impl, kind, required, change, since) FOLD_##kind(opcode, impl)
+    MAP_OPCODE_TO_IDENTIFIER
+#undef X
+    [OP_JUMPDEST] = NULL,
+};
+
+#undef FOLD_STACK
+#undef FOLD_STATE
+#undef FOLD_STATUS
+#undef FOLD_GAS_CORRECTION
+#undef FOLD_CUSTOM
+
+/// Returns the value the instruction pushes, false if it is not a PUSH.
+bool constant_push(uint8_t opcode, const struct Instruction *instr, struct uint256_t *value)
+{
+    if (opcode >= OP_PUSH1 && opcode <= OP_PUSH8)
+        *value = (struct uint256_t){0, 0, 0, instr->arg.small_push_value};
+    else if (opcode >= OP_PUSH9 && opcode <= OP_PUSH32)
+        *value = *instr->arg.push_value;
+    else
+        return false;
+    return true;
+}
+
+/// Returns k if the value is 2^k, -1 otherwise.
+int exact_log2_256(const struct uint256_t *value)
+{
+    int log = -1;
+    for (int w = 0; w < 4; ++w)
+    {
+        uint64_t word = WORD_P(value, w);
+        if (word == 0)
+            continue;
+        if (log >= 0 || (word & (word - 1)) != 0)
+            return -1;
+        log = 64 * w + __builtin_ctzll(word);
+    }
+    return log;
+}
+
+/// Evaluates the last instructions at analysis time where their operands are known, the
+/// tail peephole of fuse_instructions() run before it:
+///   - an arithmetic, comparison or bitwise instruction, EXP, DUPn or SWAPn over PUSHes of
+///     the block becomes the PUSHes of its result, e.g. PUSH1 1 PUSH2 0x100 EXP,
+///   - a DIV or MUL by a PUSHed power of two becomes a shift, e.g. PUSH29 0x0100..00 SWAP1 DIV
+///     is PUSH1 0xe0 SHR, from Constantinople on,
+///   - the pairs without effect, DUPn POP, SWAPn SWAPn and NOT NOT, are removed.
+///
+/// The stack requirements and the base gas of the original instructions have already been
+/// accounted to the block and stay. The exponent of a folded EXP is known, so its dynamic gas
+/// is added to *gas_cost and charged with the block: the gas used does not change.
+/// Returns the number of instructions eliminated.
+int fold_constants(struct AnalysisScratch *analysis, enum evmc_revision rev, size_t block_begin, int64_t *gas_cost)
+{
+    size_t size = cvec_uint8_size(analysis->opcodes);
+    uint8_t *ops = cvec_uint8_begin(&analysis->opcodes).ref;
+    struct Instruction *instrs = cvec_instr_begin(&analysis->instrs).ref;
+    size_t tail_size = size - 1 - block_begin;
+    uint8_t opcode = ops[size - 1];
+
+    // The operands, the top in items[3]. DUPn and SWAPn only need theirs to be PUSHes, the
+    // values past the third are not kept.
+    struct uint256_t items[4];
+    size_t required = 0;
+    size_t max_required = opcode >= OP_DUP1 && opcode <= OP_DUP16 ? (size_t)(opcode - OP_DUP1) + 1 :
+                          opcode >= OP_SWAP1 && opcode <= OP_SWAP16 ? (size_t)(opcode - OP_SWAP1) + 2 :
+                          opcode == OP_EXP || fold_fns[opcode] != NULL ? (size_t)op_table_entry(rev, opcode).stack_req : 0;
+    while (required < max_required && required < tail_size &&
+           constant_push(ops[size - 2 - required], &instrs[size - 2 - required], &items[required < 3 ? 3 - required : 0]))
+        ++required;
+
+    if (max_required != 0 && required == max_required)
+    {
+        size_t dropped;
+        if (opcode >= OP_DUP1 && opcode <= OP_DUP16)
+        {
+            // A copy of the PUSH, a large one shares the constant pool entry.
+            cvec_instr_pop(&analysis->instrs);
+            cvec_uint8_pop(&analysis->opcodes);
+            cvec_instr_push(&analysis->instrs, instrs[size - 1 - required]);
+            cvec_uint8_push(&analysis->opcodes, ops[size - 1 - required]);
+            return 0;
+        }
+        if (opcode >= OP_SWAP1 && opcode <= OP_SWAP16)
+        {
+            cvec_instr_pop(&analysis->instrs);
+            cvec_uint8_pop(&analysis->opcodes);
+            struct Instruction instr = instrs[size - 2];
+            uint8_t op = ops[size - 2];
+            instrs[size - 2] = instrs[size - 1 - required];
+            ops[size - 2] = ops[size - 1 - required];
+            instrs[size - 1 - required] = instr;
+            ops[size - 1 - required] = op;
+            return 1;
+        }
+
+        struct uint256_t *top = &items[3];
+        bool result = true;
+        if (opcode == OP_EXP)
+        {
+            *gas_cost += exp_additional_cost(rev, &items[2]);
+            struct uint256_t power = {0, 0, 0, 0};
+            exp256(&items[3], &items[2], &power);
+            items[2] = power;
+        }
+        else
+        {
+            fold_fns[opcode](makeStackTop(top));
+            result = opcode != OP_POP;
+        }
+        struct uint256_t *value = &items[4 - required];
+
+        struct Instruction folded;
+        uint8_t folded_opcode = OP_PUSH8;
+        if (result && WORD_P(value, 3) == 0 && WORD_P(value, 2) == 0 && WORD_P(value, 1) == 0)
+        {
+            Instrcution_init_v(&folded, instruction_fn(rev, OP_PUSH8));
+            folded.arg.small_push_value = WORD_P(value, 0);
+        }
+        else if (result)
+        {
+            // Added to the pool while the last instruction is not a PUSH, see
+            // AnalysisScratch_grow_push_values().
+            Instrcution_init_v(&folded, instruction_fn(rev, OP_PUSH32));
+            folded.arg.push_value = AnalysisScratch_push_value(analysis, value);
+            folded_opcode = OP_PUSH32;
+        }
+
+        for (dropped = 0; dropped <= required; ++dropped)
+        {
+            cvec_instr_pop(&analysis->instrs);
+            cvec_uint8_pop(&analysis->opcodes);
+        }
+        if (!result)
+            return (int)dropped;
+        cvec_instr_push(&analysis->instrs, folded);
+        cvec_uint8_push(&analysis->opcodes, folded_opcode);
+        return (int)dropped - 1;
+    }
+
+#define TAIL(n) (tail_size > (n) ? ops[size - 1 - (n)] : OPX_BEGINBLOCK)
+    if ((TAIL(0) == OP_POP && TAIL(1) >= OP_DUP1 && TAIL(1) <= OP_DUP16) ||
+        (TAIL(0) >= OP_SWAP1 && TAIL(0) <= OP_SWAP16 && TAIL(1) == TAIL(0)) || (TAIL(0) == OP_NOT && TAIL(1) == OP_NOT))
+    {
+        for (size_t i = 0; i < 2; ++i)
+        {
+            cvec_instr_pop(&analysis->instrs);
+            cvec_uint8_pop(&analysis->opcodes);
+        }
+        return 2;
+    }
+
+    // DIV a, 2^k is SHR k, a and MUL is commutative. The power of two is PUSHed right before
+    // the SWAP1 or the MUL.
+    size_t distance = TAIL(1) == OP_SWAP1 ? 2 : 1;
+    struct uint256_t constant;
+    int shift;
+    if ((TAIL(0) == OP_MUL || (TAIL(0) == OP_DIV && distance == 2)) && tail_size > distance &&
+        constant_push(ops[size - 1 - distance], &instrs[size - 1 - distance], &constant) &&
+        (shift = exact_log2_256(&constant)) >= 0 && instruction_fn(rev, OP_SHR) != op_undefined)
+    {
+        uint8_t shift_opcode = TAIL(0) == OP_DIV ? OP_SHR : OP_SHL;
+        struct Instruction push;
+        Instrcution_init_v(&push, instruction_fn(rev, OP_PUSH1));
+        push.arg.small_push_value = (uint64_t)shift;
+        struct Instruction shift_instr;
+        Instrcution_init_v(&shift_instr, instruction_fn(rev, shift_opcode));
+
+        for (size_t i = 0; i <= distance; ++i)
+        {
+            cvec_instr_pop(&analysis->instrs);
+            cvec_uint8_pop(&analysis->opcodes);
+        }
+        cvec_instr_push(&analysis->instrs, push);
+        cvec_uint8_push(&analysis->opcodes, OP_PUSH1);
+        cvec_instr_push(&analysis->instrs, shift_instr);
+        cvec_uint8_push(&analysis->opcodes, shift_opcode);
+        return (int)distance - 1;
+    }
+#undef TAIL
+    return 0;
+}
+
+/// Returns the jump destination index to build for the code, resolving JUMPDEST_INDEX_AUTO.
+enum jumpdest_index_kind select_jumpdest_index(size_t code_size)
+{
+    enum jumpdest_index_kind kind = jumpdest_index_option;
+    if (kind == JUMPDEST_INDEX_AUTO)
+        kind = code_size <= JUMPDEST_DENSE_MAX_CODE_SIZE ? JUMPDEST_INDEX_DENSE : JUMPDEST_INDEX_BITMAP;
+    return kind;
+}
 
-    int max_instrs_size = code_size + 1;
-    cvec_instr_reserve(&analysis.instrs, max_instrs_size);
+/// Returns the analysis mode for the code, resolving ANALYSIS_AUTO.
+enum analysis_mode select_analysis_mode(size_t code_size)
+{
+    enum analysis_mode mode = analysis_mode_option;
+    if (mode == ANALYSIS_AUTO)
+        mode = code_size >= LAZY_ANALYSIS_MIN_CODE_SIZE ? ANALYSIS_LAZY : ANALYSIS_EAGER;
+    return mode;
+}
+
+/// Fills the jump destination index allocated by CodeAnalysis_alloc() from jumpdest_offsets
+/// and jumpdest_targets. These have to be complete, i.e. the whole code analyzed.
+void build_jumpdest_index(struct CodeAnalysis *analysis)
+{
+    size_t count = analysis->jumpdests_size;
+    const int32_t *offsets = analysis->jumpdest_offsets;
+    const int32_t *targets = analysis->jumpdest_targets;
+
+    if (analysis->jumpdest_index == JUMPDEST_INDEX_DENSE)
+    {
+        int32_t *map = analysis->jumpdest_map;
+        for (size_t i = 0; i < analysis->jumpdest_map_size; ++i)
+            map[i] = -1;
+        for (size_t i = 0; i < count; ++i)
+            map[offsets[i]] = targets[i];
+    }
+    else if (analysis->jumpdest_index == JUMPDEST_INDEX_BITMAP)
+    {
+        size_t words = analysis->jumpdest_bitmap_size;
+        uint64_t *bitmap = analysis->jumpdest_bitmap;
+        int32_t *rank = analysis->jumpdest_rank;
+        memset(bitmap, 0, words * sizeof(uint64_t));
+        for (size_t i = 0; i < count; ++i)
+            bitmap[offsets[i] / 64] |= (uint64_t)1 << (offsets[i] % 64);
+
+        int32_t jumpdests = 0;
+        for (size_t w = 0; w < words; ++w)
+        {
+            rank[w] = jumpdests;
+            jumpdests += __builtin_popcountll(bitmap[w]);
+        }
+    }
+}
+
+/// Replaces the code offsets in the static jumps created by fuse_instructions() with the indexes
+/// of the target instructions, -1 for invalid destinations. A static jump then costs a single
+/// load at execution time instead of the find_jumpdest() search.
+void resolve_static_jumps(struct CodeAnalysis *analysis)
+{
+    size_t size = analysis->instrs_size;
+    const uint8_t *ops = analysis->opcodes;
+    struct Instruction *instrs = analysis->instrs;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (ops[i] == OPX_STATIC_JUMP || ops[i] == OPX_STATIC_JUMPI)
+        {
+            if (instrs[i].arg.number >= 0)
+                instrs[i].arg.number = find_jumpdest(analysis, (int)instrs[i].arg.number);
+        }
+        else if (ops[i] == OPX_SELECTOR_JUMPI)
+            instrs[i].arg.selector_jump.dest = find_jumpdest(analysis, instrs[i].arg.selector_jump.dest);
+    }
+}
+
+/// The shortest chain of OPX_SELECTOR_JUMPI worth replacing with a hash table.
+#define SELECTOR_DISPATCH_MIN_ENTRIES 4
+
+/// Returns the number of entries of the chain of OPX_SELECTOR_JUMPI starting at the instruction i:
+/// the instruction itself and every following block made of a single OPX_SELECTOR_JUMPI.
+/// Such a block requires one stack item and grows the stack by two, which the block of the first
+/// entry has checked already, so only its gas matters.
+size_t selector_chain_size(const uint8_t *ops, const struct Instruction *instrs, size_t size, size_t i)
+{
+    if (ops[i] != OPX_SELECTOR_JUMPI)
+        return 0;
+    size_t entries = 1;
+    for (; i + 2 < size && ops[i + 1] == OPX_BEGINBLOCK && ops[i + 2] == OPX_SELECTOR_JUMPI; i += 2, ++entries)
+    {
+        struct BlockInfo block = instrs[i + 1].arg.block;
+        if (block.stack_req > 1 || block.stack_max_growth > 2)
+            break;
+    }
+    return entries;
+}
+
+/// Returns the number of slots of the hash table of a chain, at most half of them used.
+size_t selector_table_size(size_t entries)
+{
+    size_t slots = 1;
+    while (slots < 2 * entries)
+        slots *= 2;
+    return slots;
+}
+
+/// Replaces the first entry of every long enough chain of OPX_SELECTOR_JUMPI with an
+/// OPX_SELECTOR_DISPATCH and adds its hash table to the selector_slots, see
+/// opx_selector_dispatch(). The chain destinations must be resolved already. The other entries
+/// stay in place for the jumps into the middle of the chain and for the executions without
+/// gas for the whole chain.
+void build_selector_dispatch(struct AnalysisScratch *scratch)
+{
+    size_t size = cvec_uint8_size(scratch->opcodes);
+    uint8_t *ops = cvec_uint8_begin(&scratch->opcodes).ref;
+    struct Instruction *instrs = cvec_instr_begin(&scratch->instrs).ref;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        size_t entries = selector_chain_size(ops, instrs, size, i);
+        if (entries < SELECTOR_DISPATCH_MIN_ENTRIES)
+            continue;
+
+        uint32_t table = (uint32_t)cvec_slot_size(scratch->selector_slots);
+        size_t slots_size = selector_table_size(entries);
+        uint32_t mask = (uint32_t)slots_size - 1;
+        cvec_slot_resize(&scratch->selector_slots, table + slots_size + 1, (struct SelectorSlot){0, SELECTOR_SLOT_EMPTY, 0});
+        struct SelectorSlot *slots = cvec_slot_begin(&scratch->selector_slots).ref + table;
+
+        int64_t gas = 0;
+        for (size_t e = 0; e < entries; ++e)
+        {
+            const struct Instruction *entry = &instrs[i + 2 * e];
+            if (e != 0)
+                gas += instrs[i + 2 * e - 1].arg.block.gas_cost;
+
+            // Only the first of equal selectors is ever taken.
+            uint32_t selector = entry->arg.selector_jump.selector;
+            uint32_t s = selector & mask;
+            while (slots[s].dest != SELECTOR_SLOT_EMPTY && slots[s].selector != selector)
+                s = (s + 1) & mask;
+            if (slots[s].dest == SELECTOR_SLOT_EMPTY)
+                slots[s] = (struct SelectorSlot){selector, entry->arg.selector_jump.dest, gas};
+        }
+        // No match: continue after the last entry.
+        slots[slots_size] = (struct SelectorSlot){0, (int32_t)(i + 2 * entries - 1), gas};
+
+        ops[i] = OPX_SELECTOR_DISPATCH;
+        instrs[i].fn = opx_selector_dispatch;
+        instrs[i].arg.selector_dispatch.table = table;
+        instrs[i].arg.selector_dispatch.mask = mask;
+        i += 2 * entries - 2;
+    }
+}
+
+/// The most blocks a superblock is formed of.
+#define SUPERBLOCK_MAX_BLOCKS 8
+
+/// Returns true if the execution can continue with the next instruction after the opcode.
+bool opcode_falls_through(uint8_t opcode)
+{
+    switch (opcode)
+    {
+    case OP_STOP:
+    case OP_JUMP:
+    case OP_RETURN:
+    case OP_REVERT:
+    case OP_INVALID:
+    case OP_SELFDESTRUCT:
+    case OPX_STATIC_JUMP:
+        return false;
+    default:
+        return true;
+    }
+}
+
+/// Returns the position of the block starting at the instruction in AnalysisScratch::block_begins.
+size_t find_block(const int32_t *block_begins, size_t blocks, int32_t begin)
+{
+    size_t low = 0;
+    size_t high = blocks;
+    while (low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if (block_begins[middle] < begin)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    assert(low < blocks && block_begins[low] == begin);
+    return low;
+}
+
+/// Returns the BlockInfo of the block starting at the instruction, also if its BEGINBLOCK has
+/// been replaced with an OPX_SUPERBLOCK already.
+struct BlockInfo AnalysisScratch_block_info(struct AnalysisScratch *scratch, size_t begin)
+{
+    const struct Instruction *instr = cvec_instr_at(&scratch->instrs, begin);
+    if (*cvec_uint8_at(&scratch->opcodes, begin) == OPX_SUPERBLOCK)
+        return cvec_superblock_at(&scratch->superblocks, (size_t)instr->arg.number)->block;
+    return instr->arg.block;
+}
 
-    // This is 2x more than needed but using (code.size() / 2 + 1) increases page-faults 1000x.
-    int max_args_storage_size = code_size + 1;
-    cvec_u256_reserve(&analysis.push_values, max_args_storage_size);
+/// Forms the superblocks: paths of blocks, each one but the last ending with a JUMPI continuing
+/// with the next block when the condition is false, or with a static JUMP. A path is copied
+/// to the end of the instructions without the BEGINBLOCKs after the first block, and the
+/// BEGINBLOCK of its first block is replaced with an OPX_SUPERBLOCK checking the stack
+/// requirements of the whole path. The static jumps and the JUMPIs between the blocks charge
+/// the base gas of the next block and set current_block_cost, exactly as its BEGINBLOCK, so
+/// the gas left is the same at every instruction. A JUMPI taken leaves the path.
+///
+/// A block is copied into the paths of all the blocks jumping to it, so the copies are limited
+/// to SUPERBLOCK_MAX_BLOCKS per path and to half the size of the original instructions in total.
+/// The static jumps and the selector dispatch must be resolved already.
+void form_superblocks(struct AnalysisScratch *scratch)
+{
+    size_t size = cvec_instr_size(scratch->instrs);
+    size_t blocks = cvec_int32_size(scratch->block_begins);
+    const int32_t *block_begins = cvec_int32_begin(&scratch->block_begins).ref;
+    const int32_t *block_changes = cvec_int32_begin(&scratch->block_stack_changes).ref;
+    size_t budget = size / 2;
+
+#define BLOCK_END(b) ((b) + 1 < blocks ? (size_t)block_begins[(b) + 1] : size)
+    size_t path[SUPERBLOCK_MAX_BLOCKS];
+    for (size_t first = 0; first < blocks; ++first)
+    {
+        // Follow the edges, with the stack height relative to the start of the path.
+        size_t path_size = 0;
+        size_t copy_size = 0;
+        bool falls_through = false;
+        int stack_change = 0;
+        int stack_req = 0;
+        int stack_max_growth = 0;
+        for (size_t b = first;;)
+        {
+            struct BlockInfo block = AnalysisScratch_block_info(scratch, (size_t)block_begins[b]);
+            stack_req = max(stack_req, block.stack_req - stack_change);
+            stack_max_growth = max(stack_max_growth, stack_change + block.stack_max_growth);
+            stack_change += block_changes[b];
+            path[path_size++] = b;
+
+            size_t end = BLOCK_END(b);
+            copy_size += end - (size_t)block_begins[b] - 1;
+            uint8_t last = end - 1 > (size_t)block_begins[b] ? *cvec_uint8_at(&scratch->opcodes, end - 1) : OPX_BEGINBLOCK;
+            const struct Instruction *last_instr = cvec_instr_at(&scratch->instrs, end - 1);
+            size_t next = blocks;
+            if (last == OP_JUMPI || last == OPX_STATIC_JUMPI)
+                next = b + 1;
+            else if (last == OPX_STATIC_JUMP && last_instr->arg.number >= 0)
+                next = find_block(block_begins, blocks, (int32_t)last_instr->arg.number);
+
+            bool visited = false;
+            for (size_t p = 0; p < path_size; ++p)
+                visited |= path[p] == next;
+            if (next == blocks || visited || path_size == SUPERBLOCK_MAX_BLOCKS)
+            {
+                falls_through = opcode_falls_through(last);
+                copy_size += falls_through;
+                break;
+            }
+            b = next;
+        }
+        if (path_size < 2 || copy_size > budget)
+            continue;
+        budget -= copy_size;
+
+        struct Superblock superblock;
+        superblock.block = AnalysisScratch_block_info(scratch, (size_t)block_begins[first]);
+        superblock.stack_req = (int16_t)min(stack_req, INT16_MAX);
+        superblock.stack_max_growth = (int16_t)min(stack_max_growth, INT16_MAX);
+        superblock.fast = (int32_t)cvec_instr_size(scratch->instrs);
+
+        // Copy the path. The vectors grow while being copied from, so no pointers are kept.
+        for (size_t p = 0; p < path_size; ++p)
+        {
+            size_t end = BLOCK_END(path[p]);
+            for (size_t i = (size_t)block_begins[path[p]] + 1; i < end; ++i)
+            {
+                struct Instruction instr = *cvec_instr_at(&scratch->instrs, i);
+                uint8_t opcode = *cvec_uint8_at(&scratch->opcodes, i);
+                if (i == end - 1 && p + 1 < path_size)
+                {
+                    // The edge to the next block of the path.
+                    uint32_t gas_cost = AnalysisScratch_block_info(scratch, (size_t)block_begins[path[p + 1]]).gas_cost;
+                    int32_t dest = opcode == OPX_STATIC_JUMPI ? (int32_t)instr.arg.number : -1;
+                    if (opcode == OP_JUMPI)
+                    {
+                        instr.fn = opx_superblock_jumpi;
+                        opcode = OPX_SUPERBLOCK_JUMPI;
+                    }
+                    else if (opcode == OPX_STATIC_JUMPI)
+                    {
+                        instr.fn = opx_superblock_static_jumpi;
+                        opcode = OPX_SUPERBLOCK_STATIC_JUMPI;
+                    }
+                    else
+                    {
+                        instr.fn = opx_superblock_jump;
+                        opcode = OPX_SUPERBLOCK_JUMP;
+                    }
+                    instr.arg.superblock_jump.dest = dest;
+                    instr.arg.superblock_jump.gas_cost = gas_cost;
+                }
+                cvec_instr_push(&scratch->instrs, instr);
+                cvec_uint8_push(&scratch->opcodes, opcode);
+            }
+        }
+        if (falls_through)
+        {
+            // The last block continues in the original code.
+            struct Instruction jump;
+            Instrcution_init_v(&jump, opx_static_jump);
+            jump.arg.number = (int64_t)BLOCK_END(path[path_size - 1]);
+            cvec_instr_push(&scratch->instrs, jump);
+            cvec_uint8_push(&scratch->opcodes, OPX_STATIC_JUMP);
+        }
+
+        struct Instruction *head = cvec_instr_at_mut(&scratch->instrs, (size_t)block_begins[first]);
+        head->fn = opx_superblock;
+        head->arg.number = (int64_t)cvec_superblock_size(scratch->superblocks);
+        *cvec_uint8_at_mut(&scratch->opcodes, (size_t)block_begins[first]) = OPX_SUPERBLOCK;
+        cvec_superblock_push(&scratch->superblocks, superblock);
+    }
+#undef BLOCK_END
+}
+
+/// Analyzes the code from the offset into the scratch storage, block by block.
+///
+/// Without the lazy analysis the whole code is analyzed. With it, see analyze_lazy(), the
+/// analysis stops where the execution cannot go on without a jump: after a terminator not
+/// falling through, or before a JUMPDEST analyzed already, which is jumped to instead. The
+/// targets of the JUMPDESTs are then written to the lazy analysis' jump destination index.
+void analyze_blocks(struct AnalysisScratch *scratch, enum evmc_revision rev, uint8_t *code, size_t code_size,
+                    size_t offset, struct CodeAnalysis *lazy)
+{
+    instruction_exec_fn opx_beginblock_fn = instruction_fn(rev, OPX_BEGINBLOCK);
 
     // Create the first block.
     struct Instruction ins;
     Instrcution_init_v(&ins, opx_beginblock_fn);
-    cvec_instr_push(&analysis.instrs, ins);
+    cvec_instr_push(&scratch->instrs, ins);
+    cvec_uint8_push(&scratch->opcodes, OPX_BEGINBLOCK);
     struct BlockAnalysis block;
-    BlockAnalysis_init(&block);
+    BlockAnalysis_init_v(&block, cvec_instr_size(scratch->instrs) - 1);
 
     // TODO: Iterators are not used here because push_end may point way outside of code
     //       and this is not allowed and MSVC will detect it with instrumented iterators.
     uint8_t *code_begin = code;
     uint8_t *code_end = code_begin + code_size;
-    uint8_t *code_pos = code_begin;
+    uint8_t *code_pos = code_begin + offset;
     while (code_pos != code_end)
     {
         uint8_t opcode = *code_pos++;
-        struct OpTableEntry opcode_info = op_tbl.table[opcode];
+        struct OpTableEntry opcode_info = op_table_entry(rev, opcode);
 
         if(opcode == 247){
             opcode_info.stack_req = 0;
@@ -93,17 +879,26 @@ struct CodeAnalysis analyze(enum evmc_revision rev, uint8_t* code, size_t code_s
         {
             // The JUMPDEST is always the first instruction in the block.
             // We don't have to insert anything to the instruction table.
-            cvec_int32_push(&analysis.jumpdest_offsets, (int32_t)(code_pos - code_begin - 1));
-            cvec_int32_push(&analysis.jumpdest_targets, (int32_t)(cvec_instr_size(analysis.instrs) - 1));
+            int32_t jumpdest_offset = (int32_t)(code_pos - code_begin - 1);
+            int32_t jumpdest_target = (int32_t)(cvec_instr_size(scratch->instrs) - 1);
+            if (lazy != NULL)
+                lazy->jumpdest_targets[jumpdest_position(lazy, jumpdest_offset)] = jumpdest_target;
+            else
+            {
+                cvec_int32_push(&scratch->jumpdest_offsets, jumpdest_offset);
+                cvec_int32_push(&scratch->jumpdest_targets, jumpdest_target);
+            }
         }
         else
         {
             struct Instruction ins;
             Instrcution_init_v(&ins, opcode_info.fn);
-            cvec_instr_push(&analysis.instrs, ins);
+            cvec_instr_push(&scratch->instrs, ins);
+            // The values of undefined opcodes are taken by the intrinsic opcodes.
+            cvec_uint8_push(&scratch->opcodes, opcode_info.fn != op_undefined ? opcode : OP_INVALID);
         }
 
-        struct Instruction* curr_ins = cvec_instr_back(&analysis.instrs);
+        struct Instruction* curr_ins = cvec_instr_back(&scratch->instrs);
 
         // A flag whenever this is a block terminating instruction.
         bool is_terminator = false;
@@ -158,11 +953,9 @@ struct CodeAnalysis analyze(enum evmc_revision rev, uint8_t* code, size_t code_s
                 buffer[index++] = *code_pos++;
             }
 
-            struct uint256_t* push_value = (struct uint256_t*)malloc(sizeof(struct uint256_t));
-            readu256BE(buffer, push_value);
-
-            cvec_u256_push(&analysis.push_values, *push_value);
-            curr_ins->arg.push_value = push_value;
+            struct uint256_t push_value;
+            load256be(buffer, &push_value);
+            curr_ins->arg.push_value = AnalysisScratch_push_value(scratch, &push_value);
             break;
         }
 
@@ -182,31 +975,146 @@ struct CodeAnalysis analyze(enum evmc_revision rev, uint8_t* code, size_t code_s
             break;
         }
 
+        if (opcode != OP_JUMPDEST)
+        {
+            fold_constants(scratch, rev, block.begin_block_index, &block.gas_cost);
+            fuse_instructions(scratch, block.begin_block_index, lazy == NULL);
+        }
+
         // If this is a terminating instruction or the next instruction is a JUMPDESTWW
         if (is_terminator || (code_pos != code_end && *code_pos == OP_JUMPDEST))
         {
             // Save current block.
-            cvec_instr_at_mut(&analysis.instrs, block.begin_block_index)->arg.block = BlockAnalysis_close(&block);
+            AnalysisScratch_close_block(scratch, &block);
+
+            if (lazy != NULL)
+            {
+                if (is_terminator && opcode != OP_JUMPI)
+                    return;
+                int next = code_pos != code_end ? find_jumpdest(lazy, (int)(code_pos - code_begin)) : -1;
+                if (next >= 0)
+                {
+                    struct Instruction jump;
+                    Instrcution_init_v(&jump, opx_static_jump);
+                    jump.arg.number = next;
+                    cvec_instr_push(&scratch->instrs, jump);
+                    cvec_uint8_push(&scratch->opcodes, OPX_STATIC_JUMP);
+                    return;
+                }
+            }
 
             // Create a new block.
             struct Instruction tmp_ins;
             Instrcution_init_v(&tmp_ins, opx_beginblock_fn);
-            cvec_instr_push(&analysis.instrs, tmp_ins);
-            BlockAnalysis_init_v(&block, cvec_instr_size(analysis.instrs) - 1);
+            cvec_instr_push(&scratch->instrs, tmp_ins);
+            cvec_uint8_push(&scratch->opcodes, OPX_BEGINBLOCK);
+            BlockAnalysis_init_v(&block, cvec_instr_size(scratch->instrs) - 1);
         }
     }
 
     // Save current block.
-    cvec_instr_at_mut(&analysis.instrs, block.begin_block_index)->arg.block = BlockAnalysis_close(&block);
+    AnalysisScratch_close_block(scratch, &block);
 
     // Make sure the last block is terminated.
     // TODO: This is not needed if the last instruction is a terminating one.
     struct Instruction ins_stop;
-    Instrcution_init_v(&ins_stop, op_tbl.table[OP_STOP].fn);
-    cvec_instr_push(&analysis.instrs, ins_stop);
+    Instrcution_init_v(&ins_stop, instruction_fn(rev, OP_STOP));
+    cvec_instr_push(&scratch->instrs, ins_stop);
+    cvec_uint8_push(&scratch->opcodes, OP_STOP);
+}
+
+struct CodeAnalysis analyze(enum evmc_revision rev, uint8_t* code, size_t code_size)
+{
+    // The analysis is built in the scratch storage and then copied to its arena.
+    struct AnalysisScratch *scratch = AnalysisScratch_get(code_size);
+    analyze_blocks(scratch, rev, code, code_size, 0, NULL);
 
-    // Make sure the push_values has not been reallocated. Otherwise iterators are invalid.
-    assert(cvec_u256_size(analysis.push_values) <= max_args_storage_size);
+    struct CodeAnalysis view = AnalysisScratch_view(scratch, code_size);
+    resolve_static_jumps(&view);
+    build_selector_dispatch(scratch);
+    form_superblocks(scratch);
+
+    struct CodeAnalysis analysis;
+    analysis.jumpdest_index = select_jumpdest_index(code_size);
+    analysis.code_size = (int)code_size;
+    CodeAnalysis_alloc(&analysis, cvec_instr_size(scratch->instrs), cvec_u256_size(scratch->push_values),
+                       cvec_slot_size(scratch->selector_slots), cvec_superblock_size(scratch->superblocks),
+                       cvec_int32_size(scratch->jumpdest_offsets));
 
+    const struct uint256_t *scratch_push_values = cvec_u256_begin(&scratch->push_values).ref;
+    memcpy(analysis.push_values, scratch_push_values, analysis.push_values_size * sizeof(struct uint256_t));
+    memcpy(analysis.selector_slots, cvec_slot_begin(&scratch->selector_slots).ref, analysis.selector_slots_size * sizeof(struct SelectorSlot));
+    memcpy(analysis.superblocks, cvec_superblock_begin(&scratch->superblocks).ref, analysis.superblocks_size * sizeof(struct Superblock));
+    memcpy(analysis.instrs, cvec_instr_begin(&scratch->instrs).ref, analysis.instrs_size * sizeof(struct Instruction));
+    memcpy(analysis.opcodes, cvec_uint8_begin(&scratch->opcodes).ref, analysis.instrs_size);
+    memcpy(analysis.jumpdest_offsets, cvec_int32_begin(&scratch->jumpdest_offsets).ref, analysis.jumpdests_size * sizeof(int32_t));
+    memcpy(analysis.jumpdest_targets, cvec_int32_begin(&scratch->jumpdest_targets).ref, analysis.jumpdests_size * sizeof(int32_t));
+
+    // Point the pushes into the arena's constant pool.
+    for (size_t i = 0; i < analysis.instrs_size; ++i)
+        if (analysis.opcodes[i] >= OP_PUSH9 && analysis.opcodes[i] <= OP_PUSH32)
+            analysis.instrs[i].arg.push_value = analysis.push_values + (analysis.instrs[i].arg.push_value - scratch_push_values);
+
+    build_jumpdest_index(&analysis);
     return analysis;
-}
\ No newline at end of file
+}
+
+/// Starts the analysis of the code built on demand: only the code the executions reach is
+/// analyzed, from the start of the code and from every jump destination when first jumped to,
+/// see analyze_lazy_from(). This keeps the analysis of large contracts, of which a call runs a
+/// small part, down to that part, and skips the code only used by the constructor and the
+/// metadata. The optimizations needing the whole code, i.e. the static jumps, the selector
+/// dispatch and the superblocks, are not done.
+///
+/// The JUMPDESTs are found up front, to tell the invalid destinations from the ones not
+/// analyzed yet. They are indexed with a bitmap, or searched if so configured.
+struct CodeAnalysis analyze_lazy(enum evmc_revision rev, uint8_t *code, size_t code_size)
+{
+    size_t jumpdests = 0;
+    for (size_t i = 0; i < code_size; ++i)
+    {
+        if (code[i] >= OP_PUSH1 && code[i] <= OP_PUSH32)
+            i += (size_t)(code[i] - OP_PUSH1) + 1;
+        else if (code[i] == OP_JUMPDEST)
+            ++jumpdests;
+    }
+
+    struct CodeAnalysis analysis;
+    analysis.jumpdest_index = jumpdest_index_option == JUMPDEST_INDEX_SEARCH ? JUMPDEST_INDEX_SEARCH : JUMPDEST_INDEX_BITMAP;
+    analysis.code_size = (int)code_size;
+    CodeAnalysis_alloc(&analysis, 0, 0, 0, 0, jumpdests);
+
+    jumpdests = 0;
+    for (size_t i = 0; i < code_size; ++i)
+    {
+        if (code[i] >= OP_PUSH1 && code[i] <= OP_PUSH32)
+            i += (size_t)(code[i] - OP_PUSH1) + 1;
+        else if (code[i] == OP_JUMPDEST)
+        {
+            analysis.jumpdest_offsets[jumpdests] = (int32_t)i;
+            analysis.jumpdest_targets[jumpdests++] = JUMPDEST_NOT_ANALYZED;
+        }
+    }
+    build_jumpdest_index(&analysis);
+
+    analysis.lazy = (struct AnalysisScratch *)malloc(sizeof(struct AnalysisScratch));
+    AnalysisScratch_init(analysis.lazy);
+    analyze_lazy_from(&analysis, rev, code, code_size, 0);
+    return analysis;
+}
+
+/// Extends the lazy analysis with the code from the offset, see analyze_blocks(). Returns the
+/// index of the first instruction. The instructions and the push values may move.
+int analyze_lazy_from(struct CodeAnalysis *analysis, enum evmc_revision rev, uint8_t *code, size_t code_size, size_t offset)
+{
+    struct AnalysisScratch *scratch = analysis->lazy;
+    int begin = (int)cvec_instr_size(scratch->instrs);
+    analyze_blocks(scratch, rev, code, code_size, offset, analysis);
+
+    analysis->instrs = cvec_instr_begin(&scratch->instrs).ref;
+    analysis->instrs_size = cvec_instr_size(scratch->instrs);
+    analysis->opcodes = cvec_uint8_begin(&scratch->opcodes).ref;
+    analysis->push_values = cvec_u256_begin(&scratch->push_values).ref;
+    analysis->push_values_size = cvec_u256_size(scratch->push_values);
+    return begin;
+}
@@ -0,0 +1,400 @@
+#pragma once
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "analysis_impl.h"
+
+/// The persistent store of finished analyses, so code seen by an earlier run is not analyzed
+/// again. The CodeAnalysis itself holds handler and push value pointers, so it is written as
+/// a relocatable image instead: the handlers as opcodes, bound back to the handlers of the
+/// revision in one linear pass, and the push values as indexes into the image's constant pool.
+///
+/// The image layout, every section aligned to its element size:
+///
+///     struct AnalysisImageHeader
+///     struct uint256_t push_values[push_values]
+///     struct SelectorSlot selector_slots[selector_slots]
+///     uint64_t         args[instrs]            the InstructionArgument, push value indexes
+///     uint64_t         jumpdest_bitmap[jumpdest_bitmap]
+///     struct Superblock superblocks[superblocks]
+///     int32_t          jumpdest_offsets[jumpdests]
+///     int32_t          jumpdest_targets[jumpdests]
+///     int32_t          jumpdest_map[jumpdest_map]
+///     int32_t          jumpdest_rank[jumpdest_bitmap]
+///     uint8_t          opcodes[instrs]         ANALYSIS_IMAGE_UNDEFINED for undefined instructions
+///     uint8_t          code[code_size]
+///
+/// The image is in the native byte order, a foreign one fails the magic check.
+
+#define ANALYSIS_IMAGE_MAGIC 0x414d5645 // "EVMA"
+
+/// Bumped on every change of the image layout, the intrinsic opcodes or the instruction arguments.
+#define ANALYSIS_IMAGE_VERSION 3
+
+/// The opcode stored for the undefined instructions. CodeAnalysis::opcodes records them as
+/// OP_INVALID, which has a handler of its own. 0x21 is undefined in all revisions.
+#define ANALYSIS_IMAGE_UNDEFINED 0x21
+
+struct AnalysisImageHeader
+{
+    uint32_t magic;
+    uint32_t version;
+
+    /// The key the analysis has been made for, see AnalysisCacheEntry.
+    uint32_t rev;
+    uint32_t jumpdest_index_option;
+    uint32_t code_size;
+
+    uint32_t jumpdest_index;
+
+    /// The element counts of the sections.
+    uint32_t instrs;
+    uint32_t push_values;
+    uint32_t jumpdests;
+    uint32_t jumpdest_map;
+    uint32_t jumpdest_bitmap;
+    uint32_t selector_slots;
+    uint32_t superblocks;
+    uint32_t reserved;
+};
+
+/// The directory the analyses are stored in, NULL to disable the store.
+const char *analysis_store_dir = NULL;
+
+size_t AnalysisImage_size(const struct AnalysisImageHeader *header)
+{
+    return sizeof(struct AnalysisImageHeader) +
+           (size_t)header->push_values * sizeof(struct uint256_t) +
+           (size_t)header->selector_slots * sizeof(struct SelectorSlot) +
+           (size_t)header->instrs * sizeof(uint64_t) +
+           (size_t)header->jumpdest_bitmap * sizeof(uint64_t) +
+           (size_t)header->superblocks * sizeof(struct Superblock) +
+           (size_t)header->jumpdests * 2 * sizeof(int32_t) +
+           (size_t)header->jumpdest_map * sizeof(int32_t) +
+           (size_t)header->jumpdest_bitmap * sizeof(int32_t) +
+           (size_t)header->instrs +
+           (size_t)header->code_size;
+}
+
+/// Returns true if analyze() can produce the opcode, i.e. the image opcode has a handler.
+bool AnalysisImage_opcode_valid(enum evmc_revision rev, uint8_t opcode)
+{
+    switch (opcode)
+    {
+    case OPX_AND_ADDRESS:
+    case OPX_PUSH_MLOAD:
+    case OPX_ISZERO_ISZERO:
+    case OPX_SELECTOR_JUMPI:
+    case OPX_SELECTOR_DISPATCH:
+    case OPX_SUPERBLOCK:
+    case OPX_SUPERBLOCK_JUMPI:
+    case OPX_SUPERBLOCK_STATIC_JUMPI:
+    case OPX_SUPERBLOCK_JUMP:
+    case OPX_STATIC_JUMP:
+    case OPX_STATIC_JUMPI:
+    case ANALYSIS_IMAGE_UNDEFINED:
+        return true;
+    default:
+        return instruction_fn(rev, opcode) != op_undefined;
+    }
+}
+
+/// Returns the handler of the image opcode.
+instruction_exec_fn AnalysisImage_handler(enum evmc_revision rev, uint8_t opcode)
+{
+    switch (opcode)
+    {
+    case OPX_AND_ADDRESS:
+        return opx_and_address;
+    case OPX_PUSH_MLOAD:
+        return opx_push_mload;
+    case OPX_ISZERO_ISZERO:
+        return opx_iszero_iszero;
+    case OPX_SELECTOR_JUMPI:
+        return opx_selector_jumpi;
+    case OPX_SELECTOR_DISPATCH:
+        return opx_selector_dispatch;
+    case OPX_SUPERBLOCK:
+        return opx_superblock;
+    case OPX_SUPERBLOCK_JUMPI:
+        return opx_superblock_jumpi;
+    case OPX_SUPERBLOCK_STATIC_JUMPI:
+        return opx_superblock_static_jumpi;
+    case OPX_SUPERBLOCK_JUMP:
+        return opx_superblock_jump;
+    case OPX_STATIC_JUMP:
+        return opx_static_jump;
+    case OPX_STATIC_JUMPI:
+        return opx_static_jumpi;
+    case ANALYSIS_IMAGE_UNDEFINED:
+        return op_undefined;
+    default:
+        return instruction_fn(rev, opcode);
+    }
+}
+
+/// Writes the image of the analysis of the code to a new buffer. Returns the buffer, its size
+/// in image_size.
+uint8_t *CodeAnalysis_store(struct CodeAnalysis *ca, enum evmc_revision rev, uint8_t *code, size_t code_size, size_t *image_size)
+{
+    struct AnalysisImageHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = ANALYSIS_IMAGE_MAGIC;
+    header.version = ANALYSIS_IMAGE_VERSION;
+    header.rev = (uint32_t)rev;
+    header.jumpdest_index_option = (uint32_t)jumpdest_index_option;
+    header.code_size = (uint32_t)code_size;
+    header.jumpdest_index = (uint32_t)ca->jumpdest_index;
+    header.instrs = (uint32_t)ca->instrs_size;
+    header.push_values = (uint32_t)ca->push_values_size;
+    header.jumpdests = (uint32_t)ca->jumpdests_size;
+    header.jumpdest_map = (uint32_t)ca->jumpdest_map_size;
+    header.jumpdest_bitmap = (uint32_t)ca->jumpdest_bitmap_size;
+    header.selector_slots = (uint32_t)ca->selector_slots_size;
+    header.superblocks = (uint32_t)ca->superblocks_size;
+
+    *image_size = AnalysisImage_size(&header);
+    uint8_t *image = (uint8_t *)malloc(*image_size);
+    uint8_t *pos = image;
+
+#define IMAGE_WRITE(src, size) (memcpy(pos, (src), (size)), pos += (size))
+    IMAGE_WRITE(&header, sizeof(header));
+    IMAGE_WRITE(ca->push_values, header.push_values * sizeof(struct uint256_t));
+    IMAGE_WRITE(ca->selector_slots, header.selector_slots * sizeof(struct SelectorSlot));
+
+    const struct Instruction *instrs = ca->instrs;
+    const uint8_t *opcodes = ca->opcodes;
+    const struct uint256_t *push_values = ca->push_values;
+    for (size_t i = 0; i < header.instrs; ++i)
+    {
+        uint64_t arg;
+        if (opcodes[i] >= OP_PUSH9 && opcodes[i] <= OP_PUSH32)
+            arg = (uint64_t)(instrs[i].arg.push_value - push_values);
+        else
+            memcpy(&arg, &instrs[i].arg, sizeof(arg));
+        IMAGE_WRITE(&arg, sizeof(arg));
+    }
+
+    IMAGE_WRITE(ca->jumpdest_bitmap, header.jumpdest_bitmap * sizeof(uint64_t));
+    IMAGE_WRITE(ca->superblocks, header.superblocks * sizeof(struct Superblock));
+    IMAGE_WRITE(ca->jumpdest_offsets, header.jumpdests * sizeof(int32_t));
+    IMAGE_WRITE(ca->jumpdest_targets, header.jumpdests * sizeof(int32_t));
+    IMAGE_WRITE(ca->jumpdest_map, header.jumpdest_map * sizeof(int32_t));
+    IMAGE_WRITE(ca->jumpdest_rank, header.jumpdest_bitmap * sizeof(int32_t));
+
+    for (size_t i = 0; i < header.instrs; ++i)
+        *pos++ = instrs[i].fn == op_undefined ? ANALYSIS_IMAGE_UNDEFINED : opcodes[i];
+    IMAGE_WRITE(code, code_size);
+#undef IMAGE_WRITE
+
+    assert(pos == image + *image_size);
+    return image;
+}
+
+/// Rebuilds the analysis of the code from the image. Returns false if the image is not an
+/// analysis of this code for the revision and jumpdest_index_option, or is malformed.
+///
+/// The image is checked to be one CodeAnalysis_store() could have written: every index the
+/// execution follows (push values, jump targets, jump destinations) is in bounds. The
+/// gas costs and stack requirements of the blocks are taken as they are.
+bool CodeAnalysis_load(struct CodeAnalysis *ca, const uint8_t *image, size_t image_size, enum evmc_revision rev, uint8_t *code, size_t code_size)
+{
+    struct AnalysisImageHeader header;
+    if (image_size < sizeof(header))
+        return false;
+    memcpy(&header, image, sizeof(header));
+    if (header.magic != ANALYSIS_IMAGE_MAGIC || header.version != ANALYSIS_IMAGE_VERSION ||
+        header.rev != (uint32_t)rev || header.jumpdest_index_option != (uint32_t)jumpdest_index_option ||
+        header.code_size != code_size || header.instrs == 0 || image_size != AnalysisImage_size(&header))
+        return false;
+
+    const uint8_t *pos = image + sizeof(header);
+    const struct uint256_t *push_values = (const struct uint256_t *)pos;
+    pos += header.push_values * sizeof(struct uint256_t);
+    const struct SelectorSlot *selector_slots = (const struct SelectorSlot *)pos;
+    pos += header.selector_slots * sizeof(struct SelectorSlot);
+    const uint64_t *args = (const uint64_t *)pos;
+    pos += header.instrs * sizeof(uint64_t);
+    const uint64_t *jumpdest_bitmap = (const uint64_t *)pos;
+    pos += header.jumpdest_bitmap * sizeof(uint64_t);
+    const struct Superblock *superblocks = (const struct Superblock *)pos;
+    pos += header.superblocks * sizeof(struct Superblock);
+    const int32_t *jumpdest_offsets = (const int32_t *)pos;
+    pos += header.jumpdests * sizeof(int32_t);
+    const int32_t *jumpdest_targets = (const int32_t *)pos;
+    pos += header.jumpdests * sizeof(int32_t);
+    const int32_t *jumpdest_map = (const int32_t *)pos;
+    pos += header.jumpdest_map * sizeof(int32_t);
+    const int32_t *jumpdest_rank = (const int32_t *)pos;
+    pos += header.jumpdest_bitmap * sizeof(int32_t);
+    const uint8_t *opcodes = pos;
+    pos += header.instrs;
+    if (memcmp(pos, code, code_size) != 0)
+        return false;
+
+    // Running off the end is caught by the final STOP, or the final jump of a superblock.
+    int32_t instrs_size = (int32_t)header.instrs;
+    if (opcode_falls_through(opcodes[header.instrs - 1]))
+        return false;
+    for (size_t i = 0; i < header.jumpdests; ++i)
+        if (jumpdest_offsets[i] < 0 || jumpdest_offsets[i] >= (int32_t)code_size ||
+            jumpdest_targets[i] < 0 || jumpdest_targets[i] >= instrs_size)
+            return false;
+    for (size_t i = 0; i < header.jumpdest_map; ++i)
+        if (jumpdest_map[i] < -1 || jumpdest_map[i] >= instrs_size)
+            return false;
+    if (header.jumpdest_index != JUMPDEST_INDEX_SEARCH && header.jumpdest_index != JUMPDEST_INDEX_BITMAP &&
+        header.jumpdest_index != JUMPDEST_INDEX_DENSE)
+        return false;
+    if (header.jumpdest_map != (header.jumpdest_index == JUMPDEST_INDEX_DENSE ? code_size : 0) ||
+        header.jumpdest_bitmap != (header.jumpdest_index == JUMPDEST_INDEX_BITMAP ? (code_size + 63) / 64 : 0))
+        return false;
+    for (size_t w = 0; w < header.jumpdest_bitmap; ++w)
+        if (jumpdest_rank[w] < 0 || jumpdest_rank[w] + __builtin_popcountll(jumpdest_bitmap[w]) > (int32_t)header.jumpdests)
+            return false;
+    for (size_t i = 0; i < header.superblocks; ++i)
+        if (superblocks[i].fast < 0 || superblocks[i].fast >= instrs_size)
+            return false;
+    for (size_t i = 0; i < header.selector_slots; ++i)
+        if (selector_slots[i].dest != SELECTOR_SLOT_EMPTY &&
+            (selector_slots[i].dest < -1 || selector_slots[i].dest >= instrs_size || selector_slots[i].gas < 0))
+            return false;
+
+    for (size_t i = 0; i < header.instrs; ++i)
+    {
+        uint8_t opcode = opcodes[i];
+        if (!AnalysisImage_opcode_valid(rev, opcode))
+            return false;
+        if (opcode >= OP_PUSH9 && opcode <= OP_PUSH32 && args[i] >= header.push_values)
+            return false;
+        if ((opcode == OPX_STATIC_JUMP || opcode == OPX_STATIC_JUMPI) &&
+            ((int64_t)args[i] < -1 || (int64_t)args[i] >= instrs_size))
+            return false;
+        if (opcode == OPX_SELECTOR_JUMPI)
+        {
+            union InstructionArgument arg;
+            memcpy(&arg, &args[i], sizeof(arg));
+            if (arg.selector_jump.dest < -1 || arg.selector_jump.dest >= instrs_size)
+                return false;
+        }
+        if (opcode == OPX_SUPERBLOCK && args[i] >= header.superblocks)
+            return false;
+        if (opcode == OPX_SUPERBLOCK_STATIC_JUMPI)
+        {
+            union InstructionArgument arg;
+            memcpy(&arg, &args[i], sizeof(arg));
+            if (arg.superblock_jump.dest < -1 || arg.superblock_jump.dest >= instrs_size)
+                return false;
+        }
+        if (opcode == OPX_SELECTOR_DISPATCH)
+        {
+            // The table must be in bounds, its size a power of two, with an empty slot ending
+            // every probe and a fall-through slot.
+            union InstructionArgument arg;
+            memcpy(&arg, &args[i], sizeof(arg));
+            uint32_t mask = arg.selector_dispatch.mask;
+            if ((mask & (mask + 1)) != 0 || (uint64_t)arg.selector_dispatch.table + mask + 2 > header.selector_slots)
+                return false;
+            const struct SelectorSlot *table = selector_slots + arg.selector_dispatch.table;
+            bool has_empty = false;
+            for (uint32_t s = 0; s <= mask; ++s)
+                has_empty |= table[s].dest == SELECTOR_SLOT_EMPTY;
+            if (!has_empty || table[mask + 1].dest == SELECTOR_SLOT_EMPTY)
+                return false;
+        }
+    }
+
+    ca->jumpdest_index = (enum jumpdest_index_kind)header.jumpdest_index;
+    ca->code_size = (int)code_size;
+    CodeAnalysis_alloc(ca, header.instrs, header.push_values, header.selector_slots, header.superblocks, header.jumpdests);
+    memcpy(ca->push_values, push_values, header.push_values * sizeof(struct uint256_t));
+    memcpy(ca->selector_slots, selector_slots, header.selector_slots * sizeof(struct SelectorSlot));
+    memcpy(ca->superblocks, superblocks, header.superblocks * sizeof(struct Superblock));
+
+    // Bind the handlers of the revision.
+    for (size_t i = 0; i < header.instrs; ++i)
+    {
+        uint8_t opcode = opcodes[i];
+        Instrcution_init_v(&ca->instrs[i], AnalysisImage_handler(rev, opcode));
+        if (opcode >= OP_PUSH9 && opcode <= OP_PUSH32)
+            ca->instrs[i].arg.push_value = ca->push_values + args[i];
+        else
+            memcpy(&ca->instrs[i].arg, &args[i], sizeof(ca->instrs[i].arg));
+        ca->opcodes[i] = opcode != ANALYSIS_IMAGE_UNDEFINED ? opcode : OP_INVALID;
+    }
+
+    memcpy(ca->jumpdest_offsets, jumpdest_offsets, header.jumpdests * sizeof(int32_t));
+    memcpy(ca->jumpdest_targets, jumpdest_targets, header.jumpdests * sizeof(int32_t));
+    memcpy(ca->jumpdest_map, jumpdest_map, header.jumpdest_map * sizeof(int32_t));
+    memcpy(ca->jumpdest_bitmap, jumpdest_bitmap, header.jumpdest_bitmap * sizeof(uint64_t));
+    memcpy(ca->jumpdest_rank, jumpdest_rank, header.jumpdest_bitmap * sizeof(int32_t));
+    return true;
+}
+
+/// The file of the analysis in analysis_store_dir. The code hash only spreads the files, the
+/// image is checked against the code itself.
+void analysis_store_path(char *path, size_t path_size, uint64_t code_hash, enum evmc_revision rev)
+{
+    snprintf(path, path_size, "%s/%016llx-%d-%d.evma", analysis_store_dir, (unsigned long long)code_hash,
+             (int)rev, (int)jumpdest_index_option);
+}
+
+/// Loads the stored analysis of the code, mapping the image instead of reading it.
+/// Returns false if the store is disabled or has no valid analysis of the code.
+bool analysis_store_load(struct CodeAnalysis *ca, uint64_t code_hash, enum evmc_revision rev, uint8_t *code, size_t code_size)
+{
+    if (analysis_store_dir == NULL)
+        return false;
+
+    char path[4096];
+    analysis_store_path(path, sizeof(path), code_hash, rev);
+    FILE *fp = fopen(path, "rb");
+    if (fp == NULL)
+        return false;
+
+    bool loaded = false;
+    struct stat st;
+    if (fstat(fileno(fp), &st) == 0 && st.st_size > 0)
+    {
+        void *image = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fileno(fp), 0);
+        if (image != MAP_FAILED)
+        {
+            loaded = CodeAnalysis_load(ca, (const uint8_t *)image, (size_t)st.st_size, rev, code, code_size);
+            munmap(image, (size_t)st.st_size);
+        }
+    }
+    fclose(fp);
+    return loaded;
+}
+
+/// Stores the analysis of the code. The image is written to a temporary file and renamed, so
+/// concurrent runs never map a partial image. Failures are ignored, the code is analyzed again.
+void analysis_store_save(struct CodeAnalysis *ca, uint64_t code_hash, enum evmc_revision rev, uint8_t *code, size_t code_size)
+{
+    if (analysis_store_dir == NULL)
+        return;
+
+    char path[4096];
+    char tmp_path[4096 + 32];
+    analysis_store_path(path, sizeof(path), code_hash, rev);
+    snprintf(tmp_path, sizeof(tmp_path), "%s.XXXXXX", path);
+    int fd = mkstemp(tmp_path);
+    if (fd < 0)
+        return;
+    FILE *fp = fdopen(fd, "wb");
+    if (fp == NULL)
+    {
+        remove(tmp_path);
+        return;
+    }
+
+    size_t image_size;
+    uint8_t *image = CodeAnalysis_store(ca, rev, code, code_size, &image_size);
+    bool written = fwrite(image, 1, image_size, fp) == image_size;
+    if (fclose(fp) == 0 && written)
+        rename(tmp_path, path);
+    else
+        remove(tmp_path);
+    free(image);
+}
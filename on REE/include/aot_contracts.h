@@ -0,0 +1,4977 @@
+#pragma once
+
+/// Generated by tsc-vee-aot (src/aot.c), do not edit.
+
+const uint8_t aot_erc20_code[3537] = {
+    0x60, 0x60, 0x60, 0x40, 0x52, 0x34, 0x15, 0x61, 0x00, 0x0f, 0x57, 0x60, 0x00, 0x80, 0xfd, 0x5b,
+    0x60, 0x40, 0x51, 0x61, 0x0d, 0xd1, 0x38, 0x03, 0x80, 0x61, 0x0d, 0xd1, 0x83, 0x39, 0x81, 0x01,
+    0x60, 0x40, 0x52, 0x80, 0x80, 0x51, 0x90, 0x60, 0x20, 0x01, 0x90, 0x91, 0x90, 0x80, 0x51, 0x82,
+    0x01, 0x91, 0x90, 0x60, 0x20, 0x01, 0x80, 0x51, 0x90, 0x60, 0x20, 0x01, 0x90, 0x91, 0x90, 0x80,
+    0x51, 0x82, 0x01, 0x91, 0x90, 0x50, 0x50, 0x83, 0x60, 0x01, 0x60, 0x00, 0x33, 0x73, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x16, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x90, 0x81,
+    0x52, 0x60, 0x20, 0x01, 0x60, 0x00, 0x20, 0x81, 0x90, 0x55, 0x50, 0x83, 0x60, 0x00, 0x81, 0x90,
+    0x55, 0x50, 0x82, 0x60, 0x03, 0x90, 0x80, 0x51, 0x90, 0x60, 0x20, 0x01, 0x90, 0x61, 0x00, 0xa7,
+    0x92, 0x91, 0x90, 0x61, 0x00, 0xe3, 0x56, 0x5b, 0x50, 0x81, 0x60, 0x04, 0x60, 0x00, 0x61, 0x01,
+    0x00, 0x0a, 0x81, 0x54, 0x81, 0x60, 0xff, 0x02, 0x19, 0x16, 0x90, 0x83, 0x60, 0xff, 0x16, 0x02,
+    0x17, 0x90, 0x55, 0x50, 0x80, 0x60, 0x05, 0x90, 0x80, 0x51, 0x90, 0x60, 0x20, 0x01, 0x90, 0x61,
+    0x00, 0xd9, 0x92, 0x91, 0x90, 0x61, 0x00, 0xe3, 0x56, 0x5b, 0x50, 0x50, 0x50, 0x50, 0x50, 0x61,
+    0x01, 0x88, 0x56, 0x5b, 0x82, 0x80, 0x54, 0x60, 0x01, 0x81, 0x60, 0x01, 0x16, 0x15, 0x61, 0x01,
+    0x00, 0x02, 0x03, 0x16, 0x60, 0x02, 0x90, 0x04, 0x90, 0x60, 0x00, 0x52, 0x60, 0x20, 0x60, 0x00,
+    0x20, 0x90, 0x60, 0x1f, 0x01, 0x60, 0x20, 0x90, 0x04, 0x81, 0x01, 0x92, 0x82, 0x60, 0x1f, 0x10,
+    0x61, 0x01, 0x24, 0x57, 0x80, 0x51, 0x60, 0xff, 0x19, 0x16, 0x83, 0x80, 0x01, 0x17, 0x85, 0x55,
+    0x61, 0x01, 0x52, 0x56, 0x5b, 0x82, 0x80, 0x01, 0x60, 0x01, 0x01, 0x85, 0x55, 0x82, 0x15, 0x61,
+    0x01, 0x52, 0x57, 0x91, 0x82, 0x01, 0x5b, 0x82, 0x81, 0x11, 0x15, 0x61, 0x01, 0x51, 0x57, 0x82,
+    0x51, 0x82, 0x55, 0x91, 0x60, 0x20, 0x01, 0x91, 0x90, 0x60, 0x01, 0x01, 0x90, 0x61, 0x01, 0x36,
+    0x56, 0x5b, 0x5b, 0x50, 0x90, 0x50, 0x61, 0x01, 0x5f, 0x91, 0x90, 0x61, 0x01, 0x63, 0x56, 0x5b,
+    0x50, 0x90, 0x56, 0x5b, 0x61, 0x01, 0x85, 0x91, 0x90, 0x5b, 0x80, 0x82, 0x11, 0x15, 0x61, 0x01,
+    0x81, 0x57, 0x60, 0x00, 0x81, 0x60, 0x00, 0x90, 0x55, 0x50, 0x60, 0x01, 0x01, 0x61, 0x01, 0x69,
+    0x56, 0x5b, 0x50, 0x90, 0x56, 0x5b, 0x90, 0x56, 0x5b, 0x61, 0x0c, 0x3a, 0x80, 0x61, 0x01, 0x97,
+    0x60, 0x00, 0x39, 0x60, 0x00, 0xf3, 0x00, 0x60, 0x60, 0x60, 0x40, 0x52, 0x60, 0x04, 0x36, 0x10,
+    0x61, 0x00, 0xaf, 0x57, 0x60, 0x00, 0x35, 0x7c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x04, 0x63, 0xff, 0xff, 0xff, 0xff, 0x16, 0x80, 0x63, 0x06,
+    0xfd, 0xde, 0x03, 0x14, 0x61, 0x00, 0xb4, 0x57, 0x80, 0x63, 0x09, 0x5e, 0xa7, 0xb3, 0x14, 0x61,
+    0x01, 0x42, 0x57, 0x80, 0x63, 0x18, 0x16, 0x0d, 0xdd, 0x14, 0x61, 0x01, 0x9c, 0x57, 0x80, 0x63,
+    0x23, 0xb8, 0x72, 0xdd, 0x14, 0x61, 0x01, 0xc5, 0x57, 0x80, 0x63, 0x27, 0xe2, 0x35, 0xe3, 0x14,
+    0x61, 0x02, 0x3e, 0x57, 0x80, 0x63, 0x31, 0x3c, 0xe5, 0x67, 0x14, 0x61, 0x02, 0x8b, 0x57, 0x80,
+    0x63, 0x5c, 0x65, 0x81, 0x65, 0x14, 0x61, 0x02, 0xba, 0x57, 0x80, 0x63, 0x70, 0xa0, 0x82, 0x31,
+    0x14, 0x61, 0x03, 0x26, 0x57, 0x80, 0x63, 0x95, 0xd8, 0x9b, 0x41, 0x14, 0x61, 0x03, 0x73, 0x57,
+    0x80, 0x63, 0xa9, 0x05, 0x9c, 0xbb, 0x14, 0x61, 0x04, 0x01, 0x57, 0x80, 0x63, 0xdd, 0x62, 0xed,
+    0x3e, 0x14, 0x61, 0x04, 0x5b, 0x57, 0x5b, 0x60, 0x00, 0x80, 0xfd, 0x5b, 0x34, 0x15, 0x61, 0x00,
+    0xbf, 0x57, 0x60, 0x00, 0x80, 0xfd, 0x5b, 0x61, 0x00, 0xc7, 0x61, 0x04, 0xc7, 0x56, 0x5b, 0x60,
+    0x40, 0x51, 0x80, 0x80, 0x60, 0x20, 0x01, 0x82, 0x81, 0x03, 0x82, 0x52, 0x83, 0x81, 0x81, 0x51,
+    0x81, 0x52, 0x60, 0x20, 0x01, 0x91, 0x50, 0x80, 0x51, 0x90, 0x60, 0x20, 0x01, 0x90, 0x80, 0x83,
+    0x83, 0x60, 0x00, 0x5b, 0x83, 0x81, 0x10, 0x15, 0x61, 0x01, 0x07, 0x57, 0x80, 0x82, 0x01, 0x51,
+    0x81, 0x84, 0x01, 0x52, 0x60, 0x20, 0x81, 0x01, 0x90, 0x50, 0x61, 0x00, 0xec, 0x56, 0x5b, 0x50,
+    0x50, 0x50, 0x50, 0x90, 0x50, 0x90, 0x81, 0x01, 0x90, 0x60, 0x1f, 0x16, 0x80, 0x15, 0x61, 0x01,
+    0x34, 0x57, 0x80, 0x82, 0x03, 0x80, 0x51, 0x60, 0x01, 0x83, 0x60, 0x20, 0x03, 0x61, 0x01, 0x00,
+    0x0a, 0x03, 0x19, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x91, 0x50, 0x5b, 0x50, 0x92, 0x50, 0x50,
+    0x50, 0x60, 0x40, 0x51, 0x80, 0x91, 0x03, 0x90, 0xf3, 0x5b, 0x34, 0x15, 0x61, 0x01, 0x4d, 0x57,
+    0x60, 0x00, 0x80, 0xfd, 0x5b, 0x61, 0x01, 0x82, 0x60, 0x04, 0x80, 0x80, 0x35, 0x73, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x16, 0x90, 0x60, 0x20, 0x01, 0x90, 0x91, 0x90, 0x80, 0x35, 0x90, 0x60, 0x20, 0x01,
+    0x90, 0x91, 0x90, 0x50, 0x50, 0x61, 0x05, 0x65, 0x56, 0x5b, 0x60, 0x40, 0x51, 0x80, 0x82, 0x15,
+    0x15, 0x15, 0x15, 0x81, 0x52, 0x60, 0x20, 0x01, 0x91, 0x50, 0x50, 0x60, 0x40, 0x51, 0x80, 0x91,
+    0x03, 0x90, 0xf3, 0x5b, 0x34, 0x15, 0x61, 0x01, 0xa7, 0x57, 0x60, 0x00, 0x80, 0xfd, 0x5b, 0x61,
+    0x01, 0xaf, 0x61, 0x06, 0x57, 0x56, 0x5b, 0x60, 0x40, 0x51, 0x80, 0x82, 0x81, 0x52, 0x60, 0x20,
+    0x01, 0x91, 0x50, 0x50, 0x60, 0x40, 0x51, 0x80, 0x91, 0x03, 0x90, 0xf3, 0x5b, 0x34, 0x15, 0x61,
+    0x01, 0xd0, 0x57, 0x60, 0x00, 0x80, 0xfd, 0x5b, 0x61, 0x02, 0x24, 0x60, 0x04, 0x80, 0x80, 0x35,
+    0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x90, 0x60, 0x20, 0x01, 0x90, 0x91, 0x90, 0x80, 0x35, 0x73,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x16, 0x90, 0x60, 0x20, 0x01, 0x90, 0x91, 0x90, 0x80, 0x35, 0x90, 0x60,
+    0x20, 0x01, 0x90, 0x91, 0x90, 0x50, 0x50, 0x61, 0x06, 0x5d, 0x56, 0x5b, 0x60, 0x40, 0x51, 0x80,
+    0x82, 0x15, 0x15, 0x15, 0x15, 0x81, 0x52, 0x60, 0x20, 0x01, 0x91, 0x50, 0x50, 0x60, 0x40, 0x51,
+    0x80, 0x91, 0x03, 0x90, 0xf3, 0x5b, 0x34, 0x15, 0x61, 0x02, 0x49, 0x57, 0x60, 0x00, 0x80, 0xfd,
+    0x5b, 0x61, 0x02, 0x75, 0x60, 0x04, 0x80, 0x80, 0x35, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x90,
+    0x60, 0x20, 0x01, 0x90, 0x91, 0x90, 0x50, 0x50, 0x61, 0x08, 0xf7, 0x56, 0x5b, 0x60, 0x40, 0x51,
+    0x80, 0x82, 0x81, 0x52, 0x60, 0x20, 0x01, 0x91, 0x50, 0x50, 0x60, 0x40, 0x51, 0x80, 0x91, 0x03,
+    0x90, 0xf3, 0x5b, 0x34, 0x15, 0x61, 0x02, 0x96, 0x57, 0x60, 0x00, 0x80, 0xfd, 0x5b, 0x61, 0x02,
+    0x9e, 0x61, 0x09, 0x0f, 0x56, 0x5b, 0x60, 0x40, 0x51, 0x80, 0x82, 0x60, 0xff, 0x16, 0x60, 0xff,
+    0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x91, 0x50, 0x50, 0x60, 0x40, 0x51, 0x80, 0x91, 0x03, 0x90,
+    0xf3, 0x5b, 0x34, 0x15, 0x61, 0x02, 0xc5, 0x57, 0x60, 0x00, 0x80, 0xfd, 0x5b, 0x61, 0x03, 0x10,
+    0x60, 0x04, 0x80, 0x80, 0x35, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x90, 0x60, 0x20, 0x01, 0x90,
+    0x91, 0x90, 0x80, 0x35, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x90, 0x60, 0x20, 0x01, 0x90, 0x91,
+    0x90, 0x50, 0x50, 0x61, 0x09, 0x22, 0x56, 0x5b, 0x60, 0x40, 0x51, 0x80, 0x82, 0x81, 0x52, 0x60,
+    0x20, 0x01, 0x91, 0x50, 0x50, 0x60, 0x40, 0x51, 0x80, 0x91, 0x03, 0x90, 0xf3, 0x5b, 0x34, 0x15,
+    0x61, 0x03, 0x31, 0x57, 0x60, 0x00, 0x80, 0xfd, 0x5b, 0x61, 0x03, 0x5d, 0x60, 0x04, 0x80, 0x80,
+    0x35, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x90, 0x60, 0x20, 0x01, 0x90, 0x91, 0x90, 0x50, 0x50,
+    0x61, 0x09, 0x47, 0x56, 0x5b, 0x60, 0x40, 0x51, 0x80, 0x82, 0x81, 0x52, 0x60, 0x20, 0x01, 0x91,
+    0x50, 0x50, 0x60, 0x40, 0x51, 0x80, 0x91, 0x03, 0x90, 0xf3, 0x5b, 0x34, 0x15, 0x61, 0x03, 0x7e,
+    0x57, 0x60, 0x00, 0x80, 0xfd, 0x5b, 0x61, 0x03, 0x86, 0x61, 0x09, 0x90, 0x56, 0x5b, 0x60, 0x40,
+    0x51, 0x80, 0x80, 0x60, 0x20, 0x01, 0x82, 0x81, 0x03, 0x82, 0x52, 0x83, 0x81, 0x81, 0x51, 0x81,
+    0x52, 0x60, 0x20, 0x01, 0x91, 0x50, 0x80, 0x51, 0x90, 0x60, 0x20, 0x01, 0x90, 0x80, 0x83, 0x83,
+    0x60, 0x00, 0x5b, 0x83, 0x81, 0x10, 0x15, 0x61, 0x03, 0xc6, 0x57, 0x80, 0x82, 0x01, 0x51, 0x81,
+    0x84, 0x01, 0x52, 0x60, 0x20, 0x81, 0x01, 0x90, 0x50, 0x61, 0x03, 0xab, 0x56, 0x5b, 0x50, 0x50,
+    0x50, 0x50, 0x90, 0x50, 0x90, 0x81, 0x01, 0x90, 0x60, 0x1f, 0x16, 0x80, 0x15, 0x61, 0x03, 0xf3,
+    0x57, 0x80, 0x82, 0x03, 0x80, 0x51, 0x60, 0x01, 0x83, 0x60, 0x20, 0x03, 0x61, 0x01, 0x00, 0x0a,
+    0x03, 0x19, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x91, 0x50, 0x5b, 0x50, 0x92, 0x50, 0x50, 0x50,
+    0x60, 0x40, 0x51, 0x80, 0x91, 0x03, 0x90, 0xf3, 0x5b, 0x34, 0x15, 0x61, 0x04, 0x0c, 0x57, 0x60,
+    0x00, 0x80, 0xfd, 0x5b, 0x61, 0x04, 0x41, 0x60, 0x04, 0x80, 0x80, 0x35, 0x73, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x16, 0x90, 0x60, 0x20, 0x01, 0x90, 0x91, 0x90, 0x80, 0x35, 0x90, 0x60, 0x20, 0x01, 0x90,
+    0x91, 0x90, 0x50, 0x50, 0x61, 0x0a, 0x2e, 0x56, 0x5b, 0x60, 0x40, 0x51, 0x80, 0x82, 0x15, 0x15,
+    0x15, 0x15, 0x81, 0x52, 0x60, 0x20, 0x01, 0x91, 0x50, 0x50, 0x60, 0x40, 0x51, 0x80, 0x91, 0x03,
+    0x90, 0xf3, 0x5b, 0x34, 0x15, 0x61, 0x04, 0x66, 0x57, 0x60, 0x00, 0x80, 0xfd, 0x5b, 0x61, 0x04,
+    0xb1, 0x60, 0x04, 0x80, 0x80, 0x35, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x90, 0x60, 0x20, 0x01,
+    0x90, 0x91, 0x90, 0x80, 0x35, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x90, 0x60, 0x20, 0x01, 0x90,
+    0x91, 0x90, 0x50, 0x50, 0x61, 0x0b, 0x87, 0x56, 0x5b, 0x60, 0x40, 0x51, 0x80, 0x82, 0x81, 0x52,
+    0x60, 0x20, 0x01, 0x91, 0x50, 0x50, 0x60, 0x40, 0x51, 0x80, 0x91, 0x03, 0x90, 0xf3, 0x5b, 0x60,
+    0x03, 0x80, 0x54, 0x60, 0x01, 0x81, 0x60, 0x01, 0x16, 0x15, 0x61, 0x01, 0x00, 0x02, 0x03, 0x16,
+    0x60, 0x02, 0x90, 0x04, 0x80, 0x60, 0x1f, 0x01, 0x60, 0x20, 0x80, 0x91, 0x04, 0x02, 0x60, 0x20,
+    0x01, 0x60, 0x40, 0x51, 0x90, 0x81, 0x01, 0x60, 0x40, 0x52, 0x80, 0x92, 0x91, 0x90, 0x81, 0x81,
+    0x52, 0x60, 0x20, 0x01, 0x82, 0x80, 0x54, 0x60, 0x01, 0x81, 0x60, 0x01, 0x16, 0x15, 0x61, 0x01,
+    0x00, 0x02, 0x03, 0x16, 0x60, 0x02, 0x90, 0x04, 0x80, 0x15, 0x61, 0x05, 0x5d, 0x57, 0x80, 0x60,
+    0x1f, 0x10, 0x61, 0x05, 0x32, 0x57, 0x61, 0x01, 0x00, 0x80, 0x83, 0x54, 0x04, 0x02, 0x83, 0x52,
+    0x91, 0x60, 0x20, 0x01, 0x91, 0x61, 0x05, 0x5d, 0x56, 0x5b, 0x82, 0x01, 0x91, 0x90, 0x60, 0x00,
+    0x52, 0x60, 0x20, 0x60, 0x00, 0x20, 0x90, 0x5b, 0x81, 0x54, 0x81, 0x52, 0x90, 0x60, 0x01, 0x01,
+    0x90, 0x60, 0x20, 0x01, 0x80, 0x83, 0x11, 0x61, 0x05, 0x40, 0x57, 0x82, 0x90, 0x03, 0x60, 0x1f,
+    0x16, 0x82, 0x01, 0x91, 0x5b, 0x50, 0x50, 0x50, 0x50, 0x50, 0x81, 0x56, 0x5b, 0x60, 0x00, 0x81,
+    0x60, 0x02, 0x60, 0x00, 0x33, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x73, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x90, 0x81, 0x52, 0x60, 0x20, 0x01, 0x60, 0x00, 0x20, 0x60,
+    0x00, 0x85, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x81, 0x52,
+    0x60, 0x20, 0x01, 0x90, 0x81, 0x52, 0x60, 0x20, 0x01, 0x60, 0x00, 0x20, 0x81, 0x90, 0x55, 0x50,
+    0x82, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x33, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x7f, 0x8c,
+    0x5b, 0xe1, 0xe5, 0xeb, 0xec, 0x7d, 0x5b, 0xd1, 0x4f, 0x71, 0x42, 0x7d, 0x1e, 0x84, 0xf3, 0xdd,
+    0x03, 0x14, 0xc0, 0xf7, 0xb2, 0x29, 0x1e, 0x5b, 0x20, 0x0a, 0xc8, 0xc7, 0xc3, 0xb9, 0x25, 0x84,
+    0x60, 0x40, 0x51, 0x80, 0x82, 0x81, 0x52, 0x60, 0x20, 0x01, 0x91, 0x50, 0x50, 0x60, 0x40, 0x51,
+    0x80, 0x91, 0x03, 0x90, 0xa3, 0x60, 0x01, 0x90, 0x50, 0x92, 0x91, 0x50, 0x50, 0x56, 0x5b, 0x60,
+    0x00, 0x54, 0x81, 0x56, 0x5b, 0x60, 0x00, 0x80, 0x60, 0x02, 0x60, 0x00, 0x86, 0x73, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x16, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x90, 0x81,
+    0x52, 0x60, 0x20, 0x01, 0x60, 0x00, 0x20, 0x60, 0x00, 0x33, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16,
+    0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x90, 0x81, 0x52, 0x60, 0x20,
+    0x01, 0x60, 0x00, 0x20, 0x54, 0x90, 0x50, 0x82, 0x60, 0x01, 0x60, 0x00, 0x87, 0x73, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x16, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x90, 0x81,
+    0x52, 0x60, 0x20, 0x01, 0x60, 0x00, 0x20, 0x54, 0x10, 0x15, 0x80, 0x15, 0x61, 0x07, 0x2e, 0x57,
+    0x50, 0x82, 0x81, 0x10, 0x15, 0x5b, 0x15, 0x15, 0x61, 0x07, 0x39, 0x57, 0x60, 0x00, 0x80, 0xfd,
+    0x5b, 0x82, 0x60, 0x01, 0x60, 0x00, 0x86, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x73, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x90, 0x81, 0x52, 0x60, 0x20, 0x01, 0x60, 0x00,
+    0x20, 0x60, 0x00, 0x82, 0x82, 0x54, 0x01, 0x92, 0x50, 0x50, 0x81, 0x90, 0x55, 0x50, 0x82, 0x60,
+    0x01, 0x60, 0x00, 0x87, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16,
+    0x81, 0x52, 0x60, 0x20, 0x01, 0x90, 0x81, 0x52, 0x60, 0x20, 0x01, 0x60, 0x00, 0x20, 0x60, 0x00,
+    0x82, 0x82, 0x54, 0x03, 0x92, 0x50, 0x50, 0x81, 0x90, 0x55, 0x50, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0x10, 0x15, 0x61,
+    0x08, 0x86, 0x57, 0x82, 0x60, 0x02, 0x60, 0x00, 0x87, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x73,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x90, 0x81, 0x52, 0x60, 0x20, 0x01,
+    0x60, 0x00, 0x20, 0x60, 0x00, 0x33, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x73, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x90, 0x81, 0x52, 0x60, 0x20, 0x01, 0x60, 0x00, 0x20,
+    0x60, 0x00, 0x82, 0x82, 0x54, 0x03, 0x92, 0x50, 0x50, 0x81, 0x90, 0x55, 0x50, 0x5b, 0x83, 0x73,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x16, 0x85, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x7f, 0xdd, 0xf2, 0x52,
+    0xad, 0x1b, 0xe2, 0xc8, 0x9b, 0x69, 0xc2, 0xb0, 0x68, 0xfc, 0x37, 0x8d, 0xaa, 0x95, 0x2b, 0xa7,
+    0xf1, 0x63, 0xc4, 0xa1, 0x16, 0x28, 0xf5, 0x5a, 0x4d, 0xf5, 0x23, 0xb3, 0xef, 0x85, 0x60, 0x40,
+    0x51, 0x80, 0x82, 0x81, 0x52, 0x60, 0x20, 0x01, 0x91, 0x50, 0x50, 0x60, 0x40, 0x51, 0x80, 0x91,
+    0x03, 0x90, 0xa3, 0x60, 0x01, 0x91, 0x50, 0x50, 0x93, 0x92, 0x50, 0x50, 0x50, 0x56, 0x5b, 0x60,
+    0x01, 0x60, 0x20, 0x52, 0x80, 0x60, 0x00, 0x52, 0x60, 0x40, 0x60, 0x00, 0x20, 0x60, 0x00, 0x91,
+    0x50, 0x90, 0x50, 0x54, 0x81, 0x56, 0x5b, 0x60, 0x04, 0x60, 0x00, 0x90, 0x54, 0x90, 0x61, 0x01,
+    0x00, 0x0a, 0x90, 0x04, 0x60, 0xff, 0x16, 0x81, 0x56, 0x5b, 0x60, 0x02, 0x60, 0x20, 0x52, 0x81,
+    0x60, 0x00, 0x52, 0x60, 0x40, 0x60, 0x00, 0x20, 0x60, 0x20, 0x52, 0x80, 0x60, 0x00, 0x52, 0x60,
+    0x40, 0x60, 0x00, 0x20, 0x60, 0x00, 0x91, 0x50, 0x91, 0x50, 0x50, 0x54, 0x81, 0x56, 0x5b, 0x60,
+    0x00, 0x60, 0x01, 0x60, 0x00, 0x83, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x73, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x90, 0x81, 0x52, 0x60, 0x20, 0x01, 0x60, 0x00, 0x20,
+    0x54, 0x90, 0x50, 0x91, 0x90, 0x50, 0x56, 0x5b, 0x60, 0x05, 0x80, 0x54, 0x60, 0x01, 0x81, 0x60,
+    0x01, 0x16, 0x15, 0x61, 0x01, 0x00, 0x02, 0x03, 0x16, 0x60, 0x02, 0x90, 0x04, 0x80, 0x60, 0x1f,
+    0x01, 0x60, 0x20, 0x80, 0x91, 0x04, 0x02, 0x60, 0x20, 0x01, 0x60, 0x40, 0x51, 0x90, 0x81, 0x01,
+    0x60, 0x40, 0x52, 0x80, 0x92, 0x91, 0x90, 0x81, 0x81, 0x52, 0x60, 0x20, 0x01, 0x82, 0x80, 0x54,
+    0x60, 0x01, 0x81, 0x60, 0x01, 0x16, 0x15, 0x61, 0x01, 0x00, 0x02, 0x03, 0x16, 0x60, 0x02, 0x90,
+    0x04, 0x80, 0x15, 0x61, 0x0a, 0x26, 0x57, 0x80, 0x60, 0x1f, 0x10, 0x61, 0x09, 0xfb, 0x57, 0x61,
+    0x01, 0x00, 0x80, 0x83, 0x54, 0x04, 0x02, 0x83, 0x52, 0x91, 0x60, 0x20, 0x01, 0x91, 0x61, 0x0a,
+    0x26, 0x56, 0x5b, 0x82, 0x01, 0x91, 0x90, 0x60, 0x00, 0x52, 0x60, 0x20, 0x60, 0x00, 0x20, 0x90,
+    0x5b, 0x81, 0x54, 0x81, 0x52, 0x90, 0x60, 0x01, 0x01, 0x90, 0x60, 0x20, 0x01, 0x80, 0x83, 0x11,
+    0x61, 0x0a, 0x09, 0x57, 0x82, 0x90, 0x03, 0x60, 0x1f, 0x16, 0x82, 0x01, 0x91, 0x5b, 0x50, 0x50,
+    0x50, 0x50, 0x50, 0x81, 0x56, 0x5b, 0x60, 0x00, 0x81, 0x60, 0x01, 0x60, 0x00, 0x33, 0x73, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x16, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x90,
+    0x81, 0x52, 0x60, 0x20, 0x01, 0x60, 0x00, 0x20, 0x54, 0x10, 0x15, 0x15, 0x15, 0x61, 0x0a, 0x7e,
+    0x57, 0x60, 0x00, 0x80, 0xfd, 0x5b, 0x81, 0x60, 0x01, 0x60, 0x00, 0x33, 0x73, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x16, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x90, 0x81, 0x52,
+    0x60, 0x20, 0x01, 0x60, 0x00, 0x20, 0x60, 0x00, 0x82, 0x82, 0x54, 0x03, 0x92, 0x50, 0x50, 0x81,
+    0x90, 0x55, 0x50, 0x81, 0x60, 0x01, 0x60, 0x00, 0x85, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x73,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x90, 0x81, 0x52, 0x60, 0x20, 0x01,
+    0x60, 0x00, 0x20, 0x60, 0x00, 0x82, 0x82, 0x54, 0x01, 0x92, 0x50, 0x50, 0x81, 0x90, 0x55, 0x50,
+    0x82, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x33, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x7f, 0xdd,
+    0xf2, 0x52, 0xad, 0x1b, 0xe2, 0xc8, 0x9b, 0x69, 0xc2, 0xb0, 0x68, 0xfc, 0x37, 0x8d, 0xaa, 0x95,
+    0x2b, 0xa7, 0xf1, 0x63, 0xc4, 0xa1, 0x16, 0x28, 0xf5, 0x5a, 0x4d, 0xf5, 0x23, 0xb3, 0xef, 0x84,
+    0x60, 0x40, 0x51, 0x80, 0x82, 0x81, 0x52, 0x60, 0x20, 0x01, 0x91, 0x50, 0x50, 0x60, 0x40, 0x51,
+    0x80, 0x91, 0x03, 0x90, 0xa3, 0x60, 0x01, 0x90, 0x50, 0x92, 0x91, 0x50, 0x50, 0x56, 0x5b, 0x60,
+    0x00, 0x60, 0x02, 0x60, 0x00, 0x84, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x73, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x90, 0x81, 0x52, 0x60, 0x20, 0x01, 0x60, 0x00, 0x20,
+    0x60, 0x00, 0x83, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x81,
+    0x52, 0x60, 0x20, 0x01, 0x90, 0x81, 0x52, 0x60, 0x20, 0x01, 0x60, 0x00, 0x20, 0x54, 0x90, 0x50,
+    0x92, 0x91, 0x50, 0x50, 0x56, 0x00, 0xa1, 0x65, 0x62, 0x7a, 0x7a, 0x72, 0x30, 0x58, 0x20, 0xa0,
+    0x4b, 0x03, 0xa9, 0x8b, 0x16, 0x5f, 0x64, 0x98, 0x4c, 0xff, 0x39, 0x51, 0xdf, 0x45, 0x23, 0xc8,
+    0x8e, 0x24, 0xd7, 0xa0, 0xf7, 0x63, 0xd4, 0x64, 0xac, 0xa0, 0x96, 0xb3, 0xb4, 0x70, 0xdd, 0x00,
+    0x29,
+};
+
+struct evmc_result aot_erc20(struct ExecutionState *state)
+{
+    struct uint256_t *bottom = StackSpace_bottom(&state->stack_space);
+    struct uint256_t *top = bottom;
+    struct uint256_t *destination;
+    enum evmc_status_code status;
+
+    // 0x0000
+    AOT_BLOCK(27, 0, 2);
+    AOT_PUSH_SMALL(0x60);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(callvalue, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_000f);
+
+    // 0x000b
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x000f
+L_000f:
+    AOT_BLOCK(291, 0, 9);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_PUSH_SMALL(0xdd1);
+    AOT_STATE(codesize, 1);
+    AOT_STACK(sub, -1);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0xdd1);
+    AOT_STATE(dup4, 1);
+    AOT_STATUS(codecopy, -3);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup4, 1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(caller, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(swap1, 0);
+    AOT_GAS_CORRECTION(sstore, -2, 66);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup4, 1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(swap1, 0);
+    AOT_GAS_CORRECTION(sstore, -2, 52);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup3, 1);
+    AOT_PUSH_SMALL(0x3);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0xa7);
+    AOT_STATE(swap3, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    goto L_00e3;
+
+    // 0x00a7
+L_00a7:
+    AOT_BLOCK(220, 3, 5);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup2, 1);
+    AOT_PUSH_SMALL(0x4);
+    AOT_PUSH_SMALL(0x0);
+    AOT_PUSH_SMALL(0x100);
+    AOT_STATUS(exp_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(sload, 0);
+    AOT_STATE(dup2, 1);
+    AOT_PUSH_SMALL(0xff);
+    AOT_STACK(mul, -1);
+    AOT_STACK(not_, 0);
+    AOT_STACK(and_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup4, 1);
+    AOT_PUSH_SMALL(0xff);
+    AOT_STACK(and_, -1);
+    AOT_STACK(mul, -1);
+    AOT_STACK(or_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_GAS_CORRECTION(sstore, -2, 52);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x5);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0xd9);
+    AOT_STATE(swap3, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    goto L_00e3;
+
+    // 0x00d9
+L_00d9:
+    AOT_BLOCK(22, 5, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    goto L_0188;
+
+    // 0x00e3
+L_00e3:
+    AOT_BLOCK(243, 3, 5);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(sload, 0);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STATE(dup2, 1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STACK(and_, -1);
+    AOT_STACK(iszero, 0);
+    AOT_PUSH_SMALL(0x100);
+    AOT_STACK(mul, -1);
+    AOT_STACK(sub, -1);
+    AOT_STACK(and_, -1);
+    AOT_PUSH_SMALL(0x2);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(div_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x1f);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(div_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap3, 0);
+    AOT_STATE(dup3, 1);
+    AOT_PUSH_SMALL(0x1f);
+    AOT_STACK(lt, -1);
+    AOT_STATIC_JUMPI(L_0124);
+
+    // 0x0114
+    AOT_BLOCK(41, 5, 3);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(mload, 0);
+    AOT_PUSH_SMALL(0xff);
+    AOT_STACK(not_, 0);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup4, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STACK(add, -1);
+    AOT_STACK(or_, -1);
+    AOT_STATE(dup6, 1);
+    AOT_GAS_CORRECTION(sstore, -2, 11);
+    goto L_0152;
+
+    // 0x0124
+L_0124:
+    AOT_BLOCK(38, 5, 2);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STACK(add, -1);
+    AOT_STATE(dup6, 1);
+    AOT_GAS_CORRECTION(sstore, -2, 19);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_0152);
+
+    // 0x0133
+    AOT_BLOCK(9, 3, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(add, -1);
+
+    // 0x0136
+L_0136:
+    AOT_BLOCK(26, 3, 2);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(gt, -1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_0151);
+
+    // 0x013f
+    AOT_BLOCK(44, 3, 2);
+    AOT_STATE(dup3, 1);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup3, 1);
+    AOT_GAS_CORRECTION(sstore, -2, 35);
+    AOT_STATE(swap2, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    goto L_0136;
+
+    // 0x0151
+L_0151:
+    AOT_BLOCK(1, 0, 0);
+
+    // 0x0152
+L_0152:
+    AOT_BLOCK(28, 4, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x15f);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    goto L_0163;
+
+    // 0x015f
+L_015f:
+    AOT_BLOCK(14, 3, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap1, 0);
+    AOT_JUMP();
+
+    // 0x0163
+L_0163:
+    AOT_BLOCK(10, 2, 1);
+    AOT_PUSH_SMALL(0x185);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+
+    // 0x0169
+L_0169:
+    AOT_BLOCK(26, 2, 2);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(gt, -1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_0181);
+
+    // 0x0172
+    AOT_BLOCK(31, 1, 3);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup2, 1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(swap1, 0);
+    AOT_GAS_CORRECTION(sstore, -2, 19);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STACK(add, -1);
+    goto L_0169;
+
+    // 0x0181
+L_0181:
+    AOT_BLOCK(14, 3, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap1, 0);
+    AOT_JUMP();
+
+    // 0x0185
+L_0185:
+    AOT_BLOCK(12, 2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_JUMP();
+
+    // 0x0188
+L_0188:
+    AOT_BLOCK(19, 0, 4);
+    AOT_PUSH_SMALL(0xc3a);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x197);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(codecopy, -3);
+    AOT_PUSH_SMALL(0x0);
+    AOT_TERMINATE(return_);
+
+    // 0x0196
+    AOT_BLOCK(0, 0, 0);
+    AOT_EXIT(EVMC_SUCCESS);
+
+    // 0x0197
+    AOT_BLOCK(30, 0, 2);
+    AOT_PUSH_SMALL(0x60);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x4);
+    AOT_STATE(calldatasize, 1);
+    AOT_STACK(lt, -1);
+    AOT_BAD_JUMPI();
+
+    // 0x01a4
+    AOT_BLOCK(45, 0, 3);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(calldataload, 0);
+    AOT_PUSH(0x100000000, 0x0, 0x0, 0x0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(div_, -1);
+    AOT_PUSH_SMALL(0xffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x6fdde03);
+    AOT_STACK(eq, -1);
+    AOT_BAD_JUMPI();
+
+    // 0x01d8
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x95ea7b3);
+    AOT_STACK(eq, -1);
+    AOT_BAD_JUMPI();
+
+    // 0x01e3
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x18160ddd);
+    AOT_STACK(eq, -1);
+    AOT_BAD_JUMPI();
+
+    // 0x01ee
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x23b872dd);
+    AOT_STACK(eq, -1);
+    AOT_BAD_JUMPI();
+
+    // 0x01f9
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x27e235e3);
+    AOT_STACK(eq, -1);
+    AOT_BAD_JUMPI();
+
+    // 0x0204
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x313ce567);
+    AOT_STACK(eq, -1);
+    AOT_BAD_JUMPI();
+
+    // 0x020f
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x5c658165);
+    AOT_STACK(eq, -1);
+    AOT_BAD_JUMPI();
+
+    // 0x021a
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x70a08231);
+    AOT_STACK(eq, -1);
+    AOT_BAD_JUMPI();
+
+    // 0x0225
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x95d89b41);
+    AOT_STACK(eq, -1);
+    AOT_BAD_JUMPI();
+
+    // 0x0230
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0xa9059cbb);
+    AOT_STACK(eq, -1);
+    AOT_BAD_JUMPI();
+
+    // 0x023b
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0xdd62ed3e);
+    AOT_STACK(eq, -1);
+    AOT_BAD_JUMPI();
+
+    // 0x0246
+L_0246:
+    AOT_BLOCK(7, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x024b
+L_024b:
+    AOT_BLOCK(19, 0, 2);
+    AOT_STATE(callvalue, 1);
+    AOT_STACK(iszero, 0);
+    AOT_BAD_JUMPI();
+
+    // 0x0252
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x0256
+L_0256:
+    AOT_BLOCK(15, 0, 2);
+    AOT_PUSH_SMALL(0xc7);
+    AOT_EXIT(EVMC_BAD_JUMP_DESTINATION);
+
+    // 0x025e
+L_025e:
+    AOT_BLOCK(93, 1, 9);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(sub, -1);
+    AOT_STATE(dup3, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(dup4, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup4, 1);
+    AOT_STATE(dup4, 1);
+    AOT_PUSH_SMALL(0x0);
+
+    // 0x0283
+L_0283:
+    AOT_BLOCK(26, 4, 2);
+    AOT_STATE(dup4, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(lt, -1);
+    AOT_STACK(iszero, 0);
+    AOT_BAD_JUMPI();
+
+    // 0x028c
+    AOT_BLOCK(49, 3, 3);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(add, -1);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(dup5, 1);
+    AOT_STACK(add, -1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_EXIT(EVMC_BAD_JUMP_DESTINATION);
+
+    // 0x029e
+L_029e:
+    AOT_BLOCK(51, 7, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x1f);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup1, 1);
+    AOT_STACK(iszero, 0);
+    AOT_BAD_JUMPI();
+
+    // 0x02b2
+    AOT_BLOCK(66, 2, 5);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(sub, -1);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(mload, 0);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STATE(dup4, 1);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(sub, -1);
+    AOT_PUSH_SMALL(0x100);
+    AOT_STATUS(exp_, -1);
+    AOT_STACK(sub, -1);
+    AOT_STACK(not_, 0);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+
+    // 0x02cb
+L_02cb:
+    AOT_BLOCK(30, 5, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap3, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_TERMINATE(return_);
+
+    // 0x02d9
+L_02d9:
+    AOT_BLOCK(19, 0, 2);
+    AOT_STATE(callvalue, 1);
+    AOT_STACK(iszero, 0);
+    AOT_BAD_JUMPI();
+
+    // 0x02e0
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x02e4
+L_02e4:
+    AOT_BLOCK(79, 0, 6);
+    AOT_PUSH_SMALL(0x182);
+    AOT_PUSH_SMALL(0x4);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_EXIT(EVMC_BAD_JUMP_DESTINATION);
+
+    // 0x0319
+L_0319:
+    AOT_BLOCK(62, 1, 4);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_TERMINATE(return_);
+
+    // 0x0333
+L_0333:
+    AOT_BLOCK(19, 0, 2);
+    AOT_STATE(callvalue, 1);
+    AOT_STACK(iszero, 0);
+    AOT_BAD_JUMPI();
+
+    // 0x033a
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x033e
+L_033e:
+    AOT_BLOCK(15, 0, 2);
+    AOT_PUSH_SMALL(0x1af);
+    AOT_EXIT(EVMC_BAD_JUMP_DESTINATION);
+
+    // 0x0346
+L_0346:
+    AOT_BLOCK(50, 1, 4);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_TERMINATE(return_);
+
+    // 0x035c
+L_035c:
+    AOT_BLOCK(19, 0, 2);
+    AOT_STATE(callvalue, 1);
+    AOT_STACK(iszero, 0);
+    AOT_BAD_JUMPI();
+
+    // 0x0363
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x0367
+L_0367:
+    AOT_BLOCK(109, 0, 7);
+    AOT_PUSH_SMALL(0x224);
+    AOT_PUSH_SMALL(0x4);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_EXIT(EVMC_BAD_JUMP_DESTINATION);
+
+    // 0x03bb
+L_03bb:
+    AOT_BLOCK(62, 1, 4);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_TERMINATE(return_);
+
+    // 0x03d5
+L_03d5:
+    AOT_BLOCK(19, 0, 2);
+    AOT_STATE(callvalue, 1);
+    AOT_STACK(iszero, 0);
+    AOT_BAD_JUMPI();
+
+    // 0x03dc
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x03e0
+L_03e0:
+    AOT_BLOCK(55, 0, 5);
+    AOT_PUSH_SMALL(0x275);
+    AOT_PUSH_SMALL(0x4);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_EXIT(EVMC_BAD_JUMP_DESTINATION);
+
+    // 0x040c
+L_040c:
+    AOT_BLOCK(50, 1, 4);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_TERMINATE(return_);
+
+    // 0x0422
+L_0422:
+    AOT_BLOCK(19, 0, 2);
+    AOT_STATE(callvalue, 1);
+    AOT_STACK(iszero, 0);
+    AOT_BAD_JUMPI();
+
+    // 0x0429
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x042d
+L_042d:
+    AOT_BLOCK(15, 0, 2);
+    AOT_PUSH_SMALL(0x29e);
+    AOT_EXIT(EVMC_BAD_JUMP_DESTINATION);
+
+    // 0x0435
+L_0435:
+    AOT_BLOCK(62, 1, 4);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_PUSH_SMALL(0xff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH_SMALL(0xff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_TERMINATE(return_);
+
+    // 0x0451
+L_0451:
+    AOT_BLOCK(19, 0, 2);
+    AOT_STATE(callvalue, 1);
+    AOT_STACK(iszero, 0);
+    AOT_BAD_JUMPI();
+
+    // 0x0458
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x045c
+L_045c:
+    AOT_BLOCK(85, 0, 6);
+    AOT_PUSH_SMALL(0x310);
+    AOT_PUSH_SMALL(0x4);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_EXIT(EVMC_BAD_JUMP_DESTINATION);
+
+    // 0x04a7
+L_04a7:
+    AOT_BLOCK(50, 1, 4);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_TERMINATE(return_);
+
+    // 0x04bd
+L_04bd:
+    AOT_BLOCK(19, 0, 2);
+    AOT_STATE(callvalue, 1);
+    AOT_STACK(iszero, 0);
+    AOT_BAD_JUMPI();
+
+    // 0x04c4
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x04c8
+L_04c8:
+    AOT_BLOCK(55, 0, 5);
+    AOT_PUSH_SMALL(0x35d);
+    AOT_PUSH_SMALL(0x4);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_EXIT(EVMC_BAD_JUMP_DESTINATION);
+
+    // 0x04f4
+L_04f4:
+    AOT_BLOCK(50, 1, 4);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_TERMINATE(return_);
+
+    // 0x050a
+L_050a:
+    AOT_BLOCK(19, 0, 2);
+    AOT_STATE(callvalue, 1);
+    AOT_STACK(iszero, 0);
+    AOT_BAD_JUMPI();
+
+    // 0x0511
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x0515
+L_0515:
+    AOT_BLOCK(15, 0, 2);
+    AOT_PUSH_SMALL(0x386);
+    AOT_EXIT(EVMC_BAD_JUMP_DESTINATION);
+
+    // 0x051d
+L_051d:
+    AOT_BLOCK(93, 1, 9);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(sub, -1);
+    AOT_STATE(dup3, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(dup4, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup4, 1);
+    AOT_STATE(dup4, 1);
+    AOT_PUSH_SMALL(0x0);
+
+    // 0x0542
+L_0542:
+    AOT_BLOCK(26, 4, 2);
+    AOT_STATE(dup4, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(lt, -1);
+    AOT_STACK(iszero, 0);
+    AOT_BAD_JUMPI();
+
+    // 0x054b
+    AOT_BLOCK(49, 3, 3);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(add, -1);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(dup5, 1);
+    AOT_STACK(add, -1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_EXIT(EVMC_BAD_JUMP_DESTINATION);
+
+    // 0x055d
+L_055d:
+    AOT_BLOCK(51, 7, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x1f);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup1, 1);
+    AOT_STACK(iszero, 0);
+    AOT_BAD_JUMPI();
+
+    // 0x0571
+    AOT_BLOCK(66, 2, 5);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(sub, -1);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(mload, 0);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STATE(dup4, 1);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(sub, -1);
+    AOT_PUSH_SMALL(0x100);
+    AOT_STATUS(exp_, -1);
+    AOT_STACK(sub, -1);
+    AOT_STACK(not_, 0);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+
+    // 0x058a
+L_058a:
+    AOT_BLOCK(30, 5, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap3, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_TERMINATE(return_);
+
+    // 0x0598
+L_0598:
+    AOT_BLOCK(19, 0, 2);
+    AOT_STATE(callvalue, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_040c);
+
+    // 0x059f
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x05a3
+L_05a3:
+    AOT_BLOCK(79, 0, 6);
+    AOT_PUSH_SMALL(0x441);
+    AOT_PUSH_SMALL(0x4);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_EXIT(EVMC_BAD_JUMP_DESTINATION);
+
+    // 0x05d8
+L_05d8:
+    AOT_BLOCK(62, 1, 4);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_TERMINATE(return_);
+
+    // 0x05f2
+L_05f2:
+    AOT_BLOCK(19, 0, 2);
+    AOT_STATE(callvalue, 1);
+    AOT_STACK(iszero, 0);
+    AOT_BAD_JUMPI();
+
+    // 0x05f9
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x05fd
+L_05fd:
+    AOT_BLOCK(85, 0, 6);
+    AOT_PUSH_SMALL(0x4b1);
+    AOT_PUSH_SMALL(0x4);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_EXIT(EVMC_BAD_JUMP_DESTINATION);
+
+    // 0x0648
+L_0648:
+    AOT_BLOCK(50, 1, 4);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_TERMINATE(return_);
+
+    // 0x065e
+L_065e:
+    AOT_BLOCK(394, 0, 9);
+    AOT_PUSH_SMALL(0x3);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(sload, 0);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STATE(dup2, 1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STACK(and_, -1);
+    AOT_STACK(iszero, 0);
+    AOT_PUSH_SMALL(0x100);
+    AOT_STACK(mul, -1);
+    AOT_STACK(sub, -1);
+    AOT_STACK(and_, -1);
+    AOT_PUSH_SMALL(0x2);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(div_, -1);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x1f);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(div_, -1);
+    AOT_STACK(mul, -1);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap3, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(sload, 0);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STATE(dup2, 1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STACK(and_, -1);
+    AOT_STACK(iszero, 0);
+    AOT_PUSH_SMALL(0x100);
+    AOT_STACK(mul, -1);
+    AOT_STACK(sub, -1);
+    AOT_STACK(and_, -1);
+    AOT_PUSH_SMALL(0x2);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(div_, -1);
+    AOT_STATE(dup1, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_055d);
+
+    // 0x06ae
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x1f);
+    AOT_STACK(lt, -1);
+    AOT_BAD_JUMPI();
+
+    // 0x06b6
+    AOT_BLOCK(148, 3, 3);
+    AOT_PUSH_SMALL(0x100);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup4, 1);
+    AOT_STATUS(sload, 0);
+    AOT_STACK(div_, -1);
+    AOT_STACK(mul, -1);
+    AOT_STATE(dup4, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(swap2, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    goto L_055d;
+
+    // 0x06c9
+L_06c9:
+    AOT_BLOCK(58, 3, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_STATE(swap1, 0);
+
+    // 0x06d7
+L_06d7:
+    AOT_BLOCK(150, 3, 2);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(sload, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup4, 1);
+    AOT_STACK(gt, -1);
+    AOT_BAD_JUMPI();
+
+    // 0x06eb
+    AOT_BLOCK(24, 3, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(sub, -1);
+    AOT_PUSH_SMALL(0x1f);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+
+    // 0x06f4
+L_06f4:
+    AOT_BLOCK(22, 7, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup2, 1);
+    AOT_JUMP();
+
+    // 0x06fc
+L_06fc:
+    AOT_BLOCK(1771, 3, 9);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup2, 1);
+    AOT_PUSH_SMALL(0x2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(caller, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup6, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(swap1, 0);
+    AOT_GAS_CORRECTION(sstore, -2, 1600);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup3, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(caller, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x8c5be1e5ebec7d5b, 0xd14f71427d1e84f3, 0xdd0314c0f7b2291e, 0x5b200ac8c7c3b925);
+    AOT_STATE(dup5, 1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATUS(log3, -5);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap3, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_JUMP();
+
+    // 0x07ee
+L_07ee:
+    AOT_BLOCK(115, 1, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(sload, 0);
+    AOT_STATE(dup2, 1);
+    AOT_JUMP();
+
+    // 0x07f4
+L_07f4:
+    AOT_BLOCK(479, 3, 7);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup7, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(caller, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_STATUS(sload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup3, 1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup8, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_STATUS(sload, 0);
+    AOT_STACK(lt, -1);
+    AOT_STACK(iszero, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STACK(iszero, 0);
+    AOT_BAD_JUMPI();
+
+    // 0x08c0
+    AOT_BLOCK(14, 4, 1);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(lt, -1);
+    AOT_STACK(iszero, 0);
+
+    // 0x08c5
+L_08c5:
+    AOT_BLOCK(20, 1, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_BAD_JUMPI();
+
+    // 0x08cc
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x08d0
+L_08d0:
+    AOT_BLOCK(448, 5, 5);
+    AOT_STATE(dup3, 1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup7, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATUS(sload, 0);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap3, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(swap1, 0);
+    AOT_GAS_CORRECTION(sstore, -2, 238);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup3, 1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup8, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATUS(sload, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap3, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(swap1, 0);
+    AOT_GAS_CORRECTION(sstore, -2, 27);
+    AOT_STACK(pop, -1);
+    AOT_PUSH(0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(lt, -1);
+    AOT_STACK(iszero, 0);
+    AOT_BAD_JUMPI();
+
+    // 0x0993
+    AOT_BLOCK(288, 5, 5);
+    AOT_STATE(dup3, 1);
+    AOT_PUSH_SMALL(0x2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup8, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(caller, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATUS(sload, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap3, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(swap1, 0);
+    AOT_GAS_CORRECTION(sstore, -2, 2);
+    AOT_STACK(pop, -1);
+
+    // 0x0a1d
+L_0a1d:
+    AOT_BLOCK(1604, 6, 8);
+    AOT_STATE(dup4, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup6, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0xddf252ad1be2c89b, 0x69c2b068fc378daa, 0x952ba7f163c4a116, 0x28f55a4df523b3ef);
+    AOT_STATE(dup6, 1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATUS(log3, -5);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap4, 0);
+    AOT_STATE(swap3, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_JUMP();
+
+    // 0x0a8e
+L_0a8e:
+    AOT_BLOCK(179, 2, 2);
+    AOT_PUSH_SMALL(0x1);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x40);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATUS(sload, 0);
+    AOT_STATE(dup2, 1);
+    AOT_JUMP();
+
+    // 0x0aa6
+L_0aa6:
+    AOT_BLOCK(151, 1, 3);
+    AOT_PUSH_SMALL(0x4);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(swap1, 0);
+    AOT_STATUS(sload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x100);
+    AOT_STATUS(exp_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(div_, -1);
+    AOT_PUSH_SMALL(0xff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_JUMP();
+
+    // 0x0ab9
+L_0ab9:
+    AOT_BLOCK(232, 3, 2);
+    AOT_PUSH_SMALL(0x2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(dup2, 1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x40);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x40);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STATUS(sload, 0);
+    AOT_STATE(dup2, 1);
+    AOT_JUMP();
+
+    // 0x0ade
+L_0ade:
+    AOT_BLOCK(206, 2, 5);
+    AOT_PUSH_SMALL(0x0);
+    AOT_PUSH_SMALL(0x1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup4, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_STATUS(sload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_JUMP();
+
+    // 0x0b27
+L_0b27:
+    AOT_BLOCK(394, 0, 9);
+    AOT_PUSH_SMALL(0x5);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(sload, 0);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STATE(dup2, 1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STACK(and_, -1);
+    AOT_STACK(iszero, 0);
+    AOT_PUSH_SMALL(0x100);
+    AOT_STACK(mul, -1);
+    AOT_STACK(sub, -1);
+    AOT_STACK(and_, -1);
+    AOT_PUSH_SMALL(0x2);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(div_, -1);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x1f);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(div_, -1);
+    AOT_STACK(mul, -1);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap3, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(sload, 0);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STATE(dup2, 1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STACK(and_, -1);
+    AOT_STACK(iszero, 0);
+    AOT_PUSH_SMALL(0x100);
+    AOT_STACK(mul, -1);
+    AOT_STACK(sub, -1);
+    AOT_STACK(and_, -1);
+    AOT_PUSH_SMALL(0x2);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(div_, -1);
+    AOT_STATE(dup1, 1);
+    AOT_STACK(iszero, 0);
+    AOT_BAD_JUMPI();
+
+    // 0x0b77
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x1f);
+    AOT_STACK(lt, -1);
+    AOT_BAD_JUMPI();
+
+    // 0x0b7f
+    AOT_BLOCK(148, 3, 3);
+    AOT_PUSH_SMALL(0x100);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup4, 1);
+    AOT_STATUS(sload, 0);
+    AOT_STACK(div_, -1);
+    AOT_STACK(mul, -1);
+    AOT_STATE(dup4, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(swap2, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_EXIT(EVMC_BAD_JUMP_DESTINATION);
+
+    // 0x0b92
+L_0b92:
+    AOT_BLOCK(58, 3, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_STATE(swap1, 0);
+
+    // 0x0ba0
+L_0ba0:
+    AOT_BLOCK(150, 3, 2);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(sload, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup4, 1);
+    AOT_STACK(gt, -1);
+    AOT_BAD_JUMPI();
+
+    // 0x0bb4
+    AOT_BLOCK(24, 3, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(sub, -1);
+    AOT_PUSH_SMALL(0x1f);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+
+    // 0x0bbd
+L_0bbd:
+    AOT_BLOCK(22, 7, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup2, 1);
+    AOT_JUMP();
+
+    // 0x0bc5
+L_0bc5:
+    AOT_BLOCK(212, 1, 6);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup2, 1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(caller, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_STATUS(sload, 0);
+    AOT_STACK(lt, -1);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_BAD_JUMPI();
+
+    // 0x0c11
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x0c15
+L_0c15:
+    AOT_BLOCK(2020, 4, 8);
+    AOT_STATE(dup2, 1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(caller, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATUS(sload, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap3, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(swap1, 0);
+    AOT_GAS_CORRECTION(sstore, -2, 1811);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup2, 1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup6, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATUS(sload, 0);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap3, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(swap1, 0);
+    AOT_GAS_CORRECTION(sstore, -2, 1600);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup3, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(caller, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0xddf252ad1be2c89b, 0x69c2b068fc378daa, 0x952ba7f163c4a116, 0x28f55a4df523b3ef);
+    AOT_STATE(dup5, 1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATUS(log3, -5);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap3, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_JUMP();
+
+    // 0x0d1e
+L_0d1e:
+    AOT_BLOCK(286, 3, 5);
+    AOT_PUSH_SMALL(0x0);
+    AOT_PUSH_SMALL(0x2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup5, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup4, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_STATUS(sload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap3, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_JUMP();
+
+    // 0x0da5
+    AOT_BLOCK(0, 0, 0);
+    AOT_EXIT(EVMC_SUCCESS);
+
+    // 0x0dd1
+    AOT_BLOCK(1559, 19, 0);
+    AOT_STATUS(log1, -3);
+    AOT_PUSH_SMALL(0x627a7a723058);
+    AOT_STATUS(keccak256, -1);
+    AOT_STATUS(log0, -2);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_STACK(sub, -1);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_STATE(dup12, 1);
+    AOT_STACK(and_, -1);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_PUSH_SMALL(0x984cff3951);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_STATE(gaslimit, 1);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_STATE(dup15, 1);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_STATUS(log0, -2);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_PUSH_SMALL(0xd464aca0);
+    AOT_STATE(swap7, 0);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_PUSH(0x0, 0xdd, 0x29000000000000, 0x0);
+    AOT_EXIT(EVMC_SUCCESS);
+
+jump:
+    AOT_DISPATCH(destination)
+    {
+    case 0xf:
+        goto L_000f;
+    case 0xa7:
+        goto L_00a7;
+    case 0xd9:
+        goto L_00d9;
+    case 0xe3:
+        goto L_00e3;
+    case 0x124:
+        goto L_0124;
+    case 0x136:
+        goto L_0136;
+    case 0x151:
+        goto L_0151;
+    case 0x152:
+        goto L_0152;
+    case 0x15f:
+        goto L_015f;
+    case 0x163:
+        goto L_0163;
+    case 0x169:
+        goto L_0169;
+    case 0x181:
+        goto L_0181;
+    case 0x185:
+        goto L_0185;
+    case 0x188:
+        goto L_0188;
+    case 0x246:
+        goto L_0246;
+    case 0x24b:
+        goto L_024b;
+    case 0x256:
+        goto L_0256;
+    case 0x25e:
+        goto L_025e;
+    case 0x283:
+        goto L_0283;
+    case 0x29e:
+        goto L_029e;
+    case 0x2cb:
+        goto L_02cb;
+    case 0x2d9:
+        goto L_02d9;
+    case 0x2e4:
+        goto L_02e4;
+    case 0x319:
+        goto L_0319;
+    case 0x333:
+        goto L_0333;
+    case 0x33e:
+        goto L_033e;
+    case 0x346:
+        goto L_0346;
+    case 0x35c:
+        goto L_035c;
+    case 0x367:
+        goto L_0367;
+    case 0x3bb:
+        goto L_03bb;
+    case 0x3d5:
+        goto L_03d5;
+    case 0x3e0:
+        goto L_03e0;
+    case 0x40c:
+        goto L_040c;
+    case 0x422:
+        goto L_0422;
+    case 0x42d:
+        goto L_042d;
+    case 0x435:
+        goto L_0435;
+    case 0x451:
+        goto L_0451;
+    case 0x45c:
+        goto L_045c;
+    case 0x4a7:
+        goto L_04a7;
+    case 0x4bd:
+        goto L_04bd;
+    case 0x4c8:
+        goto L_04c8;
+    case 0x4f4:
+        goto L_04f4;
+    case 0x50a:
+        goto L_050a;
+    case 0x515:
+        goto L_0515;
+    case 0x51d:
+        goto L_051d;
+    case 0x542:
+        goto L_0542;
+    case 0x55d:
+        goto L_055d;
+    case 0x58a:
+        goto L_058a;
+    case 0x598:
+        goto L_0598;
+    case 0x5a3:
+        goto L_05a3;
+    case 0x5d8:
+        goto L_05d8;
+    case 0x5f2:
+        goto L_05f2;
+    case 0x5fd:
+        goto L_05fd;
+    case 0x648:
+        goto L_0648;
+    case 0x65e:
+        goto L_065e;
+    case 0x6c9:
+        goto L_06c9;
+    case 0x6d7:
+        goto L_06d7;
+    case 0x6f4:
+        goto L_06f4;
+    case 0x6fc:
+        goto L_06fc;
+    case 0x7ee:
+        goto L_07ee;
+    case 0x7f4:
+        goto L_07f4;
+    case 0x8c5:
+        goto L_08c5;
+    case 0x8d0:
+        goto L_08d0;
+    case 0xa1d:
+        goto L_0a1d;
+    case 0xa8e:
+        goto L_0a8e;
+    case 0xaa6:
+        goto L_0aa6;
+    case 0xab9:
+        goto L_0ab9;
+    case 0xade:
+        goto L_0ade;
+    case 0xb27:
+        goto L_0b27;
+    case 0xb92:
+        goto L_0b92;
+    case 0xba0:
+        goto L_0ba0;
+    case 0xbbd:
+        goto L_0bbd;
+    case 0xbc5:
+        goto L_0bc5;
+    case 0xc15:
+        goto L_0c15;
+    case 0xd1e:
+        goto L_0d1e;
+    }
+    AOT_EXIT(EVMC_BAD_JUMP_DESTINATION);
+
+exit:
+    return aot_result(state, status);
+}
+
+const uint8_t aot_erc20_runtime_code[3130] = {
+    0x60, 0x60, 0x60, 0x40, 0x52, 0x60, 0x04, 0x36, 0x10, 0x61, 0x00, 0xaf, 0x57, 0x60, 0x00, 0x35,
+    0x7c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x04,
+    0x63, 0xff, 0xff, 0xff, 0xff, 0x16, 0x80, 0x63, 0x06, 0xfd, 0xde, 0x03, 0x14, 0x61, 0x00, 0xb4,
+    0x57, 0x80, 0x63, 0x09, 0x5e, 0xa7, 0xb3, 0x14, 0x61, 0x01, 0x42, 0x57, 0x80, 0x63, 0x18, 0x16,
+    0x0d, 0xdd, 0x14, 0x61, 0x01, 0x9c, 0x57, 0x80, 0x63, 0x23, 0xb8, 0x72, 0xdd, 0x14, 0x61, 0x01,
+    0xc5, 0x57, 0x80, 0x63, 0x27, 0xe2, 0x35, 0xe3, 0x14, 0x61, 0x02, 0x3e, 0x57, 0x80, 0x63, 0x31,
+    0x3c, 0xe5, 0x67, 0x14, 0x61, 0x02, 0x8b, 0x57, 0x80, 0x63, 0x5c, 0x65, 0x81, 0x65, 0x14, 0x61,
+    0x02, 0xba, 0x57, 0x80, 0x63, 0x70, 0xa0, 0x82, 0x31, 0x14, 0x61, 0x03, 0x26, 0x57, 0x80, 0x63,
+    0x95, 0xd8, 0x9b, 0x41, 0x14, 0x61, 0x03, 0x73, 0x57, 0x80, 0x63, 0xa9, 0x05, 0x9c, 0xbb, 0x14,
+    0x61, 0x04, 0x01, 0x57, 0x80, 0x63, 0xdd, 0x62, 0xed, 0x3e, 0x14, 0x61, 0x04, 0x5b, 0x57, 0x5b,
+    0x60, 0x00, 0x80, 0xfd, 0x5b, 0x34, 0x15, 0x61, 0x00, 0xbf, 0x57, 0x60, 0x00, 0x80, 0xfd, 0x5b,
+    0x61, 0x00, 0xc7, 0x61, 0x04, 0xc7, 0x56, 0x5b, 0x60, 0x40, 0x51, 0x80, 0x80, 0x60, 0x20, 0x01,
+    0x82, 0x81, 0x03, 0x82, 0x52, 0x83, 0x81, 0x81, 0x51, 0x81, 0x52, 0x60, 0x20, 0x01, 0x91, 0x50,
+    0x80, 0x51, 0x90, 0x60, 0x20, 0x01, 0x90, 0x80, 0x83, 0x83, 0x60, 0x00, 0x5b, 0x83, 0x81, 0x10,
+    0x15, 0x61, 0x01, 0x07, 0x57, 0x80, 0x82, 0x01, 0x51, 0x81, 0x84, 0x01, 0x52, 0x60, 0x20, 0x81,
+    0x01, 0x90, 0x50, 0x61, 0x00, 0xec, 0x56, 0x5b, 0x50, 0x50, 0x50, 0x50, 0x90, 0x50, 0x90, 0x81,
+    0x01, 0x90, 0x60, 0x1f, 0x16, 0x80, 0x15, 0x61, 0x01, 0x34, 0x57, 0x80, 0x82, 0x03, 0x80, 0x51,
+    0x60, 0x01, 0x83, 0x60, 0x20, 0x03, 0x61, 0x01, 0x00, 0x0a, 0x03, 0x19, 0x16, 0x81, 0x52, 0x60,
+    0x20, 0x01, 0x91, 0x50, 0x5b, 0x50, 0x92, 0x50, 0x50, 0x50, 0x60, 0x40, 0x51, 0x80, 0x91, 0x03,
+    0x90, 0xf3, 0x5b, 0x34, 0x15, 0x61, 0x01, 0x4d, 0x57, 0x60, 0x00, 0x80, 0xfd, 0x5b, 0x61, 0x01,
+    0x82, 0x60, 0x04, 0x80, 0x80, 0x35, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x90, 0x60, 0x20, 0x01,
+    0x90, 0x91, 0x90, 0x80, 0x35, 0x90, 0x60, 0x20, 0x01, 0x90, 0x91, 0x90, 0x50, 0x50, 0x61, 0x05,
+    0x65, 0x56, 0x5b, 0x60, 0x40, 0x51, 0x80, 0x82, 0x15, 0x15, 0x15, 0x15, 0x81, 0x52, 0x60, 0x20,
+    0x01, 0x91, 0x50, 0x50, 0x60, 0x40, 0x51, 0x80, 0x91, 0x03, 0x90, 0xf3, 0x5b, 0x34, 0x15, 0x61,
+    0x01, 0xa7, 0x57, 0x60, 0x00, 0x80, 0xfd, 0x5b, 0x61, 0x01, 0xaf, 0x61, 0x06, 0x57, 0x56, 0x5b,
+    0x60, 0x40, 0x51, 0x80, 0x82, 0x81, 0x52, 0x60, 0x20, 0x01, 0x91, 0x50, 0x50, 0x60, 0x40, 0x51,
+    0x80, 0x91, 0x03, 0x90, 0xf3, 0x5b, 0x34, 0x15, 0x61, 0x01, 0xd0, 0x57, 0x60, 0x00, 0x80, 0xfd,
+    0x5b, 0x61, 0x02, 0x24, 0x60, 0x04, 0x80, 0x80, 0x35, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x90,
+    0x60, 0x20, 0x01, 0x90, 0x91, 0x90, 0x80, 0x35, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x90, 0x60,
+    0x20, 0x01, 0x90, 0x91, 0x90, 0x80, 0x35, 0x90, 0x60, 0x20, 0x01, 0x90, 0x91, 0x90, 0x50, 0x50,
+    0x61, 0x06, 0x5d, 0x56, 0x5b, 0x60, 0x40, 0x51, 0x80, 0x82, 0x15, 0x15, 0x15, 0x15, 0x81, 0x52,
+    0x60, 0x20, 0x01, 0x91, 0x50, 0x50, 0x60, 0x40, 0x51, 0x80, 0x91, 0x03, 0x90, 0xf3, 0x5b, 0x34,
+    0x15, 0x61, 0x02, 0x49, 0x57, 0x60, 0x00, 0x80, 0xfd, 0x5b, 0x61, 0x02, 0x75, 0x60, 0x04, 0x80,
+    0x80, 0x35, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x90, 0x60, 0x20, 0x01, 0x90, 0x91, 0x90, 0x50,
+    0x50, 0x61, 0x08, 0xf7, 0x56, 0x5b, 0x60, 0x40, 0x51, 0x80, 0x82, 0x81, 0x52, 0x60, 0x20, 0x01,
+    0x91, 0x50, 0x50, 0x60, 0x40, 0x51, 0x80, 0x91, 0x03, 0x90, 0xf3, 0x5b, 0x34, 0x15, 0x61, 0x02,
+    0x96, 0x57, 0x60, 0x00, 0x80, 0xfd, 0x5b, 0x61, 0x02, 0x9e, 0x61, 0x09, 0x0f, 0x56, 0x5b, 0x60,
+    0x40, 0x51, 0x80, 0x82, 0x60, 0xff, 0x16, 0x60, 0xff, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x91,
+    0x50, 0x50, 0x60, 0x40, 0x51, 0x80, 0x91, 0x03, 0x90, 0xf3, 0x5b, 0x34, 0x15, 0x61, 0x02, 0xc5,
+    0x57, 0x60, 0x00, 0x80, 0xfd, 0x5b, 0x61, 0x03, 0x10, 0x60, 0x04, 0x80, 0x80, 0x35, 0x73, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x16, 0x90, 0x60, 0x20, 0x01, 0x90, 0x91, 0x90, 0x80, 0x35, 0x73, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x16, 0x90, 0x60, 0x20, 0x01, 0x90, 0x91, 0x90, 0x50, 0x50, 0x61, 0x09, 0x22, 0x56,
+    0x5b, 0x60, 0x40, 0x51, 0x80, 0x82, 0x81, 0x52, 0x60, 0x20, 0x01, 0x91, 0x50, 0x50, 0x60, 0x40,
+    0x51, 0x80, 0x91, 0x03, 0x90, 0xf3, 0x5b, 0x34, 0x15, 0x61, 0x03, 0x31, 0x57, 0x60, 0x00, 0x80,
+    0xfd, 0x5b, 0x61, 0x03, 0x5d, 0x60, 0x04, 0x80, 0x80, 0x35, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16,
+    0x90, 0x60, 0x20, 0x01, 0x90, 0x91, 0x90, 0x50, 0x50, 0x61, 0x09, 0x47, 0x56, 0x5b, 0x60, 0x40,
+    0x51, 0x80, 0x82, 0x81, 0x52, 0x60, 0x20, 0x01, 0x91, 0x50, 0x50, 0x60, 0x40, 0x51, 0x80, 0x91,
+    0x03, 0x90, 0xf3, 0x5b, 0x34, 0x15, 0x61, 0x03, 0x7e, 0x57, 0x60, 0x00, 0x80, 0xfd, 0x5b, 0x61,
+    0x03, 0x86, 0x61, 0x09, 0x90, 0x56, 0x5b, 0x60, 0x40, 0x51, 0x80, 0x80, 0x60, 0x20, 0x01, 0x82,
+    0x81, 0x03, 0x82, 0x52, 0x83, 0x81, 0x81, 0x51, 0x81, 0x52, 0x60, 0x20, 0x01, 0x91, 0x50, 0x80,
+    0x51, 0x90, 0x60, 0x20, 0x01, 0x90, 0x80, 0x83, 0x83, 0x60, 0x00, 0x5b, 0x83, 0x81, 0x10, 0x15,
+    0x61, 0x03, 0xc6, 0x57, 0x80, 0x82, 0x01, 0x51, 0x81, 0x84, 0x01, 0x52, 0x60, 0x20, 0x81, 0x01,
+    0x90, 0x50, 0x61, 0x03, 0xab, 0x56, 0x5b, 0x50, 0x50, 0x50, 0x50, 0x90, 0x50, 0x90, 0x81, 0x01,
+    0x90, 0x60, 0x1f, 0x16, 0x80, 0x15, 0x61, 0x03, 0xf3, 0x57, 0x80, 0x82, 0x03, 0x80, 0x51, 0x60,
+    0x01, 0x83, 0x60, 0x20, 0x03, 0x61, 0x01, 0x00, 0x0a, 0x03, 0x19, 0x16, 0x81, 0x52, 0x60, 0x20,
+    0x01, 0x91, 0x50, 0x5b, 0x50, 0x92, 0x50, 0x50, 0x50, 0x60, 0x40, 0x51, 0x80, 0x91, 0x03, 0x90,
+    0xf3, 0x5b, 0x34, 0x15, 0x61, 0x04, 0x0c, 0x57, 0x60, 0x00, 0x80, 0xfd, 0x5b, 0x61, 0x04, 0x41,
+    0x60, 0x04, 0x80, 0x80, 0x35, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x90, 0x60, 0x20, 0x01, 0x90,
+    0x91, 0x90, 0x80, 0x35, 0x90, 0x60, 0x20, 0x01, 0x90, 0x91, 0x90, 0x50, 0x50, 0x61, 0x0a, 0x2e,
+    0x56, 0x5b, 0x60, 0x40, 0x51, 0x80, 0x82, 0x15, 0x15, 0x15, 0x15, 0x81, 0x52, 0x60, 0x20, 0x01,
+    0x91, 0x50, 0x50, 0x60, 0x40, 0x51, 0x80, 0x91, 0x03, 0x90, 0xf3, 0x5b, 0x34, 0x15, 0x61, 0x04,
+    0x66, 0x57, 0x60, 0x00, 0x80, 0xfd, 0x5b, 0x61, 0x04, 0xb1, 0x60, 0x04, 0x80, 0x80, 0x35, 0x73,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x16, 0x90, 0x60, 0x20, 0x01, 0x90, 0x91, 0x90, 0x80, 0x35, 0x73, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x16, 0x90, 0x60, 0x20, 0x01, 0x90, 0x91, 0x90, 0x50, 0x50, 0x61, 0x0b, 0x87,
+    0x56, 0x5b, 0x60, 0x40, 0x51, 0x80, 0x82, 0x81, 0x52, 0x60, 0x20, 0x01, 0x91, 0x50, 0x50, 0x60,
+    0x40, 0x51, 0x80, 0x91, 0x03, 0x90, 0xf3, 0x5b, 0x60, 0x03, 0x80, 0x54, 0x60, 0x01, 0x81, 0x60,
+    0x01, 0x16, 0x15, 0x61, 0x01, 0x00, 0x02, 0x03, 0x16, 0x60, 0x02, 0x90, 0x04, 0x80, 0x60, 0x1f,
+    0x01, 0x60, 0x20, 0x80, 0x91, 0x04, 0x02, 0x60, 0x20, 0x01, 0x60, 0x40, 0x51, 0x90, 0x81, 0x01,
+    0x60, 0x40, 0x52, 0x80, 0x92, 0x91, 0x90, 0x81, 0x81, 0x52, 0x60, 0x20, 0x01, 0x82, 0x80, 0x54,
+    0x60, 0x01, 0x81, 0x60, 0x01, 0x16, 0x15, 0x61, 0x01, 0x00, 0x02, 0x03, 0x16, 0x60, 0x02, 0x90,
+    0x04, 0x80, 0x15, 0x61, 0x05, 0x5d, 0x57, 0x80, 0x60, 0x1f, 0x10, 0x61, 0x05, 0x32, 0x57, 0x61,
+    0x01, 0x00, 0x80, 0x83, 0x54, 0x04, 0x02, 0x83, 0x52, 0x91, 0x60, 0x20, 0x01, 0x91, 0x61, 0x05,
+    0x5d, 0x56, 0x5b, 0x82, 0x01, 0x91, 0x90, 0x60, 0x00, 0x52, 0x60, 0x20, 0x60, 0x00, 0x20, 0x90,
+    0x5b, 0x81, 0x54, 0x81, 0x52, 0x90, 0x60, 0x01, 0x01, 0x90, 0x60, 0x20, 0x01, 0x80, 0x83, 0x11,
+    0x61, 0x05, 0x40, 0x57, 0x82, 0x90, 0x03, 0x60, 0x1f, 0x16, 0x82, 0x01, 0x91, 0x5b, 0x50, 0x50,
+    0x50, 0x50, 0x50, 0x81, 0x56, 0x5b, 0x60, 0x00, 0x81, 0x60, 0x02, 0x60, 0x00, 0x33, 0x73, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x16, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x90,
+    0x81, 0x52, 0x60, 0x20, 0x01, 0x60, 0x00, 0x20, 0x60, 0x00, 0x85, 0x73, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x16, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x90, 0x81, 0x52, 0x60,
+    0x20, 0x01, 0x60, 0x00, 0x20, 0x81, 0x90, 0x55, 0x50, 0x82, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16,
+    0x33, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x7f, 0x8c, 0x5b, 0xe1, 0xe5, 0xeb, 0xec, 0x7d, 0x5b,
+    0xd1, 0x4f, 0x71, 0x42, 0x7d, 0x1e, 0x84, 0xf3, 0xdd, 0x03, 0x14, 0xc0, 0xf7, 0xb2, 0x29, 0x1e,
+    0x5b, 0x20, 0x0a, 0xc8, 0xc7, 0xc3, 0xb9, 0x25, 0x84, 0x60, 0x40, 0x51, 0x80, 0x82, 0x81, 0x52,
+    0x60, 0x20, 0x01, 0x91, 0x50, 0x50, 0x60, 0x40, 0x51, 0x80, 0x91, 0x03, 0x90, 0xa3, 0x60, 0x01,
+    0x90, 0x50, 0x92, 0x91, 0x50, 0x50, 0x56, 0x5b, 0x60, 0x00, 0x54, 0x81, 0x56, 0x5b, 0x60, 0x00,
+    0x80, 0x60, 0x02, 0x60, 0x00, 0x86, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x73, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x90, 0x81, 0x52, 0x60, 0x20, 0x01, 0x60, 0x00, 0x20,
+    0x60, 0x00, 0x33, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x81,
+    0x52, 0x60, 0x20, 0x01, 0x90, 0x81, 0x52, 0x60, 0x20, 0x01, 0x60, 0x00, 0x20, 0x54, 0x90, 0x50,
+    0x82, 0x60, 0x01, 0x60, 0x00, 0x87, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x73, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x90, 0x81, 0x52, 0x60, 0x20, 0x01, 0x60, 0x00, 0x20,
+    0x54, 0x10, 0x15, 0x80, 0x15, 0x61, 0x07, 0x2e, 0x57, 0x50, 0x82, 0x81, 0x10, 0x15, 0x5b, 0x15,
+    0x15, 0x61, 0x07, 0x39, 0x57, 0x60, 0x00, 0x80, 0xfd, 0x5b, 0x82, 0x60, 0x01, 0x60, 0x00, 0x86,
+    0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x81, 0x52, 0x60, 0x20,
+    0x01, 0x90, 0x81, 0x52, 0x60, 0x20, 0x01, 0x60, 0x00, 0x20, 0x60, 0x00, 0x82, 0x82, 0x54, 0x01,
+    0x92, 0x50, 0x50, 0x81, 0x90, 0x55, 0x50, 0x82, 0x60, 0x01, 0x60, 0x00, 0x87, 0x73, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x16, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x90, 0x81,
+    0x52, 0x60, 0x20, 0x01, 0x60, 0x00, 0x20, 0x60, 0x00, 0x82, 0x82, 0x54, 0x03, 0x92, 0x50, 0x50,
+    0x81, 0x90, 0x55, 0x50, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0x10, 0x15, 0x61, 0x08, 0x86, 0x57, 0x82, 0x60, 0x02, 0x60,
+    0x00, 0x87, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x81, 0x52,
+    0x60, 0x20, 0x01, 0x90, 0x81, 0x52, 0x60, 0x20, 0x01, 0x60, 0x00, 0x20, 0x60, 0x00, 0x33, 0x73,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x16, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01,
+    0x90, 0x81, 0x52, 0x60, 0x20, 0x01, 0x60, 0x00, 0x20, 0x60, 0x00, 0x82, 0x82, 0x54, 0x03, 0x92,
+    0x50, 0x50, 0x81, 0x90, 0x55, 0x50, 0x5b, 0x83, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x85, 0x73,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x16, 0x7f, 0xdd, 0xf2, 0x52, 0xad, 0x1b, 0xe2, 0xc8, 0x9b, 0x69, 0xc2,
+    0xb0, 0x68, 0xfc, 0x37, 0x8d, 0xaa, 0x95, 0x2b, 0xa7, 0xf1, 0x63, 0xc4, 0xa1, 0x16, 0x28, 0xf5,
+    0x5a, 0x4d, 0xf5, 0x23, 0xb3, 0xef, 0x85, 0x60, 0x40, 0x51, 0x80, 0x82, 0x81, 0x52, 0x60, 0x20,
+    0x01, 0x91, 0x50, 0x50, 0x60, 0x40, 0x51, 0x80, 0x91, 0x03, 0x90, 0xa3, 0x60, 0x01, 0x91, 0x50,
+    0x50, 0x93, 0x92, 0x50, 0x50, 0x50, 0x56, 0x5b, 0x60, 0x01, 0x60, 0x20, 0x52, 0x80, 0x60, 0x00,
+    0x52, 0x60, 0x40, 0x60, 0x00, 0x20, 0x60, 0x00, 0x91, 0x50, 0x90, 0x50, 0x54, 0x81, 0x56, 0x5b,
+    0x60, 0x04, 0x60, 0x00, 0x90, 0x54, 0x90, 0x61, 0x01, 0x00, 0x0a, 0x90, 0x04, 0x60, 0xff, 0x16,
+    0x81, 0x56, 0x5b, 0x60, 0x02, 0x60, 0x20, 0x52, 0x81, 0x60, 0x00, 0x52, 0x60, 0x40, 0x60, 0x00,
+    0x20, 0x60, 0x20, 0x52, 0x80, 0x60, 0x00, 0x52, 0x60, 0x40, 0x60, 0x00, 0x20, 0x60, 0x00, 0x91,
+    0x50, 0x91, 0x50, 0x50, 0x54, 0x81, 0x56, 0x5b, 0x60, 0x00, 0x60, 0x01, 0x60, 0x00, 0x83, 0x73,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x16, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01,
+    0x90, 0x81, 0x52, 0x60, 0x20, 0x01, 0x60, 0x00, 0x20, 0x54, 0x90, 0x50, 0x91, 0x90, 0x50, 0x56,
+    0x5b, 0x60, 0x05, 0x80, 0x54, 0x60, 0x01, 0x81, 0x60, 0x01, 0x16, 0x15, 0x61, 0x01, 0x00, 0x02,
+    0x03, 0x16, 0x60, 0x02, 0x90, 0x04, 0x80, 0x60, 0x1f, 0x01, 0x60, 0x20, 0x80, 0x91, 0x04, 0x02,
+    0x60, 0x20, 0x01, 0x60, 0x40, 0x51, 0x90, 0x81, 0x01, 0x60, 0x40, 0x52, 0x80, 0x92, 0x91, 0x90,
+    0x81, 0x81, 0x52, 0x60, 0x20, 0x01, 0x82, 0x80, 0x54, 0x60, 0x01, 0x81, 0x60, 0x01, 0x16, 0x15,
+    0x61, 0x01, 0x00, 0x02, 0x03, 0x16, 0x60, 0x02, 0x90, 0x04, 0x80, 0x15, 0x61, 0x0a, 0x26, 0x57,
+    0x80, 0x60, 0x1f, 0x10, 0x61, 0x09, 0xfb, 0x57, 0x61, 0x01, 0x00, 0x80, 0x83, 0x54, 0x04, 0x02,
+    0x83, 0x52, 0x91, 0x60, 0x20, 0x01, 0x91, 0x61, 0x0a, 0x26, 0x56, 0x5b, 0x82, 0x01, 0x91, 0x90,
+    0x60, 0x00, 0x52, 0x60, 0x20, 0x60, 0x00, 0x20, 0x90, 0x5b, 0x81, 0x54, 0x81, 0x52, 0x90, 0x60,
+    0x01, 0x01, 0x90, 0x60, 0x20, 0x01, 0x80, 0x83, 0x11, 0x61, 0x0a, 0x09, 0x57, 0x82, 0x90, 0x03,
+    0x60, 0x1f, 0x16, 0x82, 0x01, 0x91, 0x5b, 0x50, 0x50, 0x50, 0x50, 0x50, 0x81, 0x56, 0x5b, 0x60,
+    0x00, 0x81, 0x60, 0x01, 0x60, 0x00, 0x33, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x73, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x90, 0x81, 0x52, 0x60, 0x20, 0x01, 0x60, 0x00,
+    0x20, 0x54, 0x10, 0x15, 0x15, 0x15, 0x61, 0x0a, 0x7e, 0x57, 0x60, 0x00, 0x80, 0xfd, 0x5b, 0x81,
+    0x60, 0x01, 0x60, 0x00, 0x33, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x73, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x90, 0x81, 0x52, 0x60, 0x20, 0x01, 0x60, 0x00, 0x20, 0x60,
+    0x00, 0x82, 0x82, 0x54, 0x03, 0x92, 0x50, 0x50, 0x81, 0x90, 0x55, 0x50, 0x81, 0x60, 0x01, 0x60,
+    0x00, 0x85, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x81, 0x52,
+    0x60, 0x20, 0x01, 0x90, 0x81, 0x52, 0x60, 0x20, 0x01, 0x60, 0x00, 0x20, 0x60, 0x00, 0x82, 0x82,
+    0x54, 0x01, 0x92, 0x50, 0x50, 0x81, 0x90, 0x55, 0x50, 0x82, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16,
+    0x33, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x7f, 0xdd, 0xf2, 0x52, 0xad, 0x1b, 0xe2, 0xc8, 0x9b,
+    0x69, 0xc2, 0xb0, 0x68, 0xfc, 0x37, 0x8d, 0xaa, 0x95, 0x2b, 0xa7, 0xf1, 0x63, 0xc4, 0xa1, 0x16,
+    0x28, 0xf5, 0x5a, 0x4d, 0xf5, 0x23, 0xb3, 0xef, 0x84, 0x60, 0x40, 0x51, 0x80, 0x82, 0x81, 0x52,
+    0x60, 0x20, 0x01, 0x91, 0x50, 0x50, 0x60, 0x40, 0x51, 0x80, 0x91, 0x03, 0x90, 0xa3, 0x60, 0x01,
+    0x90, 0x50, 0x92, 0x91, 0x50, 0x50, 0x56, 0x5b, 0x60, 0x00, 0x60, 0x02, 0x60, 0x00, 0x84, 0x73,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x16, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01,
+    0x90, 0x81, 0x52, 0x60, 0x20, 0x01, 0x60, 0x00, 0x20, 0x60, 0x00, 0x83, 0x73, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x16, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x81, 0x52, 0x60, 0x20, 0x01, 0x90, 0x81, 0x52,
+    0x60, 0x20, 0x01, 0x60, 0x00, 0x20, 0x54, 0x90, 0x50, 0x92, 0x91, 0x50, 0x50, 0x56, 0x00, 0xa1,
+    0x65, 0x62, 0x7a, 0x7a, 0x72, 0x30, 0x58, 0x20, 0xa0, 0x4b, 0x03, 0xa9, 0x8b, 0x16, 0x5f, 0x64,
+    0x98, 0x4c, 0xff, 0x39, 0x51, 0xdf, 0x45, 0x23, 0xc8, 0x8e, 0x24, 0xd7, 0xa0, 0xf7, 0x63, 0xd4,
+    0x64, 0xac, 0xa0, 0x96, 0xb3, 0xb4, 0x70, 0xdd, 0x00, 0x29,
+};
+
+struct evmc_result aot_erc20_runtime(struct ExecutionState *state)
+{
+    struct uint256_t *bottom = StackSpace_bottom(&state->stack_space);
+    struct uint256_t *top = bottom;
+    struct uint256_t *destination;
+    enum evmc_status_code status;
+
+    // 0x0000
+    AOT_BLOCK(30, 0, 2);
+    AOT_PUSH_SMALL(0x60);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x4);
+    AOT_STATE(calldatasize, 1);
+    AOT_STACK(lt, -1);
+    AOT_STATIC_JUMPI(L_00af);
+
+    // 0x000d
+    AOT_BLOCK(45, 0, 3);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(calldataload, 0);
+    AOT_PUSH(0x100000000, 0x0, 0x0, 0x0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(div_, -1);
+    AOT_PUSH_SMALL(0xffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x6fdde03);
+    AOT_STACK(eq, -1);
+    AOT_STATIC_JUMPI(L_00b4);
+
+    // 0x0041
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x95ea7b3);
+    AOT_STACK(eq, -1);
+    AOT_STATIC_JUMPI(L_0142);
+
+    // 0x004c
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x18160ddd);
+    AOT_STACK(eq, -1);
+    AOT_STATIC_JUMPI(L_019c);
+
+    // 0x0057
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x23b872dd);
+    AOT_STACK(eq, -1);
+    AOT_STATIC_JUMPI(L_01c5);
+
+    // 0x0062
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x27e235e3);
+    AOT_STACK(eq, -1);
+    AOT_STATIC_JUMPI(L_023e);
+
+    // 0x006d
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x313ce567);
+    AOT_STACK(eq, -1);
+    AOT_STATIC_JUMPI(L_028b);
+
+    // 0x0078
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x5c658165);
+    AOT_STACK(eq, -1);
+    AOT_STATIC_JUMPI(L_02ba);
+
+    // 0x0083
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x70a08231);
+    AOT_STACK(eq, -1);
+    AOT_STATIC_JUMPI(L_0326);
+
+    // 0x008e
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x95d89b41);
+    AOT_STACK(eq, -1);
+    AOT_STATIC_JUMPI(L_0373);
+
+    // 0x0099
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0xa9059cbb);
+    AOT_STACK(eq, -1);
+    AOT_STATIC_JUMPI(L_0401);
+
+    // 0x00a4
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0xdd62ed3e);
+    AOT_STACK(eq, -1);
+    AOT_STATIC_JUMPI(L_045b);
+
+    // 0x00af
+L_00af:
+    AOT_BLOCK(7, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x00b4
+L_00b4:
+    AOT_BLOCK(19, 0, 2);
+    AOT_STATE(callvalue, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_00bf);
+
+    // 0x00bb
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x00bf
+L_00bf:
+    AOT_BLOCK(15, 0, 2);
+    AOT_PUSH_SMALL(0xc7);
+    goto L_04c7;
+
+    // 0x00c7
+L_00c7:
+    AOT_BLOCK(93, 1, 9);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(sub, -1);
+    AOT_STATE(dup3, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(dup4, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup4, 1);
+    AOT_STATE(dup4, 1);
+    AOT_PUSH_SMALL(0x0);
+
+    // 0x00ec
+L_00ec:
+    AOT_BLOCK(26, 4, 2);
+    AOT_STATE(dup4, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(lt, -1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_0107);
+
+    // 0x00f5
+    AOT_BLOCK(49, 3, 3);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(add, -1);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(dup5, 1);
+    AOT_STACK(add, -1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    goto L_00ec;
+
+    // 0x0107
+L_0107:
+    AOT_BLOCK(51, 7, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x1f);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup1, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_0134);
+
+    // 0x011b
+    AOT_BLOCK(66, 2, 5);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(sub, -1);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(mload, 0);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STATE(dup4, 1);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(sub, -1);
+    AOT_PUSH_SMALL(0x100);
+    AOT_STATUS(exp_, -1);
+    AOT_STACK(sub, -1);
+    AOT_STACK(not_, 0);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+
+    // 0x0134
+L_0134:
+    AOT_BLOCK(30, 5, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap3, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_TERMINATE(return_);
+
+    // 0x0142
+L_0142:
+    AOT_BLOCK(19, 0, 2);
+    AOT_STATE(callvalue, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_014d);
+
+    // 0x0149
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x014d
+L_014d:
+    AOT_BLOCK(79, 0, 6);
+    AOT_PUSH_SMALL(0x182);
+    AOT_PUSH_SMALL(0x4);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    goto L_0565;
+
+    // 0x0182
+L_0182:
+    AOT_BLOCK(62, 1, 4);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_TERMINATE(return_);
+
+    // 0x019c
+L_019c:
+    AOT_BLOCK(19, 0, 2);
+    AOT_STATE(callvalue, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_01a7);
+
+    // 0x01a3
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x01a7
+L_01a7:
+    AOT_BLOCK(15, 0, 2);
+    AOT_PUSH_SMALL(0x1af);
+    goto L_0657;
+
+    // 0x01af
+L_01af:
+    AOT_BLOCK(50, 1, 4);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_TERMINATE(return_);
+
+    // 0x01c5
+L_01c5:
+    AOT_BLOCK(19, 0, 2);
+    AOT_STATE(callvalue, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_01d0);
+
+    // 0x01cc
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x01d0
+L_01d0:
+    AOT_BLOCK(109, 0, 7);
+    AOT_PUSH_SMALL(0x224);
+    AOT_PUSH_SMALL(0x4);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    goto L_065d;
+
+    // 0x0224
+L_0224:
+    AOT_BLOCK(62, 1, 4);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_TERMINATE(return_);
+
+    // 0x023e
+L_023e:
+    AOT_BLOCK(19, 0, 2);
+    AOT_STATE(callvalue, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_0249);
+
+    // 0x0245
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x0249
+L_0249:
+    AOT_BLOCK(55, 0, 5);
+    AOT_PUSH_SMALL(0x275);
+    AOT_PUSH_SMALL(0x4);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    goto L_08f7;
+
+    // 0x0275
+L_0275:
+    AOT_BLOCK(50, 1, 4);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_TERMINATE(return_);
+
+    // 0x028b
+L_028b:
+    AOT_BLOCK(19, 0, 2);
+    AOT_STATE(callvalue, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_0296);
+
+    // 0x0292
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x0296
+L_0296:
+    AOT_BLOCK(15, 0, 2);
+    AOT_PUSH_SMALL(0x29e);
+    goto L_090f;
+
+    // 0x029e
+L_029e:
+    AOT_BLOCK(62, 1, 4);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_PUSH_SMALL(0xff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH_SMALL(0xff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_TERMINATE(return_);
+
+    // 0x02ba
+L_02ba:
+    AOT_BLOCK(19, 0, 2);
+    AOT_STATE(callvalue, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_02c5);
+
+    // 0x02c1
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x02c5
+L_02c5:
+    AOT_BLOCK(85, 0, 6);
+    AOT_PUSH_SMALL(0x310);
+    AOT_PUSH_SMALL(0x4);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    goto L_0922;
+
+    // 0x0310
+L_0310:
+    AOT_BLOCK(50, 1, 4);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_TERMINATE(return_);
+
+    // 0x0326
+L_0326:
+    AOT_BLOCK(19, 0, 2);
+    AOT_STATE(callvalue, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_0331);
+
+    // 0x032d
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x0331
+L_0331:
+    AOT_BLOCK(55, 0, 5);
+    AOT_PUSH_SMALL(0x35d);
+    AOT_PUSH_SMALL(0x4);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    goto L_0947;
+
+    // 0x035d
+L_035d:
+    AOT_BLOCK(50, 1, 4);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_TERMINATE(return_);
+
+    // 0x0373
+L_0373:
+    AOT_BLOCK(19, 0, 2);
+    AOT_STATE(callvalue, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_037e);
+
+    // 0x037a
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x037e
+L_037e:
+    AOT_BLOCK(15, 0, 2);
+    AOT_PUSH_SMALL(0x386);
+    goto L_0990;
+
+    // 0x0386
+L_0386:
+    AOT_BLOCK(93, 1, 9);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(sub, -1);
+    AOT_STATE(dup3, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(dup4, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup4, 1);
+    AOT_STATE(dup4, 1);
+    AOT_PUSH_SMALL(0x0);
+
+    // 0x03ab
+L_03ab:
+    AOT_BLOCK(26, 4, 2);
+    AOT_STATE(dup4, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(lt, -1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_03c6);
+
+    // 0x03b4
+    AOT_BLOCK(49, 3, 3);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(add, -1);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(dup5, 1);
+    AOT_STACK(add, -1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    goto L_03ab;
+
+    // 0x03c6
+L_03c6:
+    AOT_BLOCK(51, 7, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x1f);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup1, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_03f3);
+
+    // 0x03da
+    AOT_BLOCK(66, 2, 5);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(sub, -1);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(mload, 0);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STATE(dup4, 1);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(sub, -1);
+    AOT_PUSH_SMALL(0x100);
+    AOT_STATUS(exp_, -1);
+    AOT_STACK(sub, -1);
+    AOT_STACK(not_, 0);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+
+    // 0x03f3
+L_03f3:
+    AOT_BLOCK(30, 5, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap3, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_TERMINATE(return_);
+
+    // 0x0401
+L_0401:
+    AOT_BLOCK(19, 0, 2);
+    AOT_STATE(callvalue, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_040c);
+
+    // 0x0408
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x040c
+L_040c:
+    AOT_BLOCK(79, 0, 6);
+    AOT_PUSH_SMALL(0x441);
+    AOT_PUSH_SMALL(0x4);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    goto L_0a2e;
+
+    // 0x0441
+L_0441:
+    AOT_BLOCK(62, 1, 4);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_TERMINATE(return_);
+
+    // 0x045b
+L_045b:
+    AOT_BLOCK(19, 0, 2);
+    AOT_STATE(callvalue, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_0466);
+
+    // 0x0462
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x0466
+L_0466:
+    AOT_BLOCK(85, 0, 6);
+    AOT_PUSH_SMALL(0x4b1);
+    AOT_PUSH_SMALL(0x4);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    goto L_0b87;
+
+    // 0x04b1
+L_04b1:
+    AOT_BLOCK(50, 1, 4);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_TERMINATE(return_);
+
+    // 0x04c7
+L_04c7:
+    AOT_BLOCK(394, 0, 9);
+    AOT_PUSH_SMALL(0x3);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(sload, 0);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STATE(dup2, 1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STACK(and_, -1);
+    AOT_STACK(iszero, 0);
+    AOT_PUSH_SMALL(0x100);
+    AOT_STACK(mul, -1);
+    AOT_STACK(sub, -1);
+    AOT_STACK(and_, -1);
+    AOT_PUSH_SMALL(0x2);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(div_, -1);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x1f);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(div_, -1);
+    AOT_STACK(mul, -1);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap3, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(sload, 0);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STATE(dup2, 1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STACK(and_, -1);
+    AOT_STACK(iszero, 0);
+    AOT_PUSH_SMALL(0x100);
+    AOT_STACK(mul, -1);
+    AOT_STACK(sub, -1);
+    AOT_STACK(and_, -1);
+    AOT_PUSH_SMALL(0x2);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(div_, -1);
+    AOT_STATE(dup1, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_055d);
+
+    // 0x0517
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x1f);
+    AOT_STACK(lt, -1);
+    AOT_STATIC_JUMPI(L_0532);
+
+    // 0x051f
+    AOT_BLOCK(148, 3, 3);
+    AOT_PUSH_SMALL(0x100);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup4, 1);
+    AOT_STATUS(sload, 0);
+    AOT_STACK(div_, -1);
+    AOT_STACK(mul, -1);
+    AOT_STATE(dup4, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(swap2, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    goto L_055d;
+
+    // 0x0532
+L_0532:
+    AOT_BLOCK(58, 3, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_STATE(swap1, 0);
+
+    // 0x0540
+L_0540:
+    AOT_BLOCK(150, 3, 2);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(sload, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup4, 1);
+    AOT_STACK(gt, -1);
+    AOT_STATIC_JUMPI(L_0540);
+
+    // 0x0554
+    AOT_BLOCK(24, 3, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(sub, -1);
+    AOT_PUSH_SMALL(0x1f);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+
+    // 0x055d
+L_055d:
+    AOT_BLOCK(22, 7, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup2, 1);
+    AOT_JUMP();
+
+    // 0x0565
+L_0565:
+    AOT_BLOCK(1771, 3, 9);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup2, 1);
+    AOT_PUSH_SMALL(0x2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(caller, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup6, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(swap1, 0);
+    AOT_GAS_CORRECTION(sstore, -2, 1600);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup3, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(caller, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x8c5be1e5ebec7d5b, 0xd14f71427d1e84f3, 0xdd0314c0f7b2291e, 0x5b200ac8c7c3b925);
+    AOT_STATE(dup5, 1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATUS(log3, -5);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap3, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_JUMP();
+
+    // 0x0657
+L_0657:
+    AOT_BLOCK(115, 1, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(sload, 0);
+    AOT_STATE(dup2, 1);
+    AOT_JUMP();
+
+    // 0x065d
+L_065d:
+    AOT_BLOCK(479, 3, 7);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup7, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(caller, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_STATUS(sload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup3, 1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup8, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_STATUS(sload, 0);
+    AOT_STACK(lt, -1);
+    AOT_STACK(iszero, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_072e);
+
+    // 0x0729
+    AOT_BLOCK(14, 4, 1);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(lt, -1);
+    AOT_STACK(iszero, 0);
+
+    // 0x072e
+L_072e:
+    AOT_BLOCK(20, 1, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_0739);
+
+    // 0x0735
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x0739
+L_0739:
+    AOT_BLOCK(448, 5, 5);
+    AOT_STATE(dup3, 1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup7, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATUS(sload, 0);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap3, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(swap1, 0);
+    AOT_GAS_CORRECTION(sstore, -2, 238);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup3, 1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup8, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATUS(sload, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap3, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(swap1, 0);
+    AOT_GAS_CORRECTION(sstore, -2, 27);
+    AOT_STACK(pop, -1);
+    AOT_PUSH(0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(lt, -1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_0886);
+
+    // 0x07fc
+    AOT_BLOCK(288, 5, 5);
+    AOT_STATE(dup3, 1);
+    AOT_PUSH_SMALL(0x2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup8, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(caller, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATUS(sload, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap3, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(swap1, 0);
+    AOT_GAS_CORRECTION(sstore, -2, 2);
+    AOT_STACK(pop, -1);
+
+    // 0x0886
+L_0886:
+    AOT_BLOCK(1604, 6, 8);
+    AOT_STATE(dup4, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup6, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0xddf252ad1be2c89b, 0x69c2b068fc378daa, 0x952ba7f163c4a116, 0x28f55a4df523b3ef);
+    AOT_STATE(dup6, 1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATUS(log3, -5);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap4, 0);
+    AOT_STATE(swap3, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_JUMP();
+
+    // 0x08f7
+L_08f7:
+    AOT_BLOCK(179, 2, 2);
+    AOT_PUSH_SMALL(0x1);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x40);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATUS(sload, 0);
+    AOT_STATE(dup2, 1);
+    AOT_JUMP();
+
+    // 0x090f
+L_090f:
+    AOT_BLOCK(151, 1, 3);
+    AOT_PUSH_SMALL(0x4);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(swap1, 0);
+    AOT_STATUS(sload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x100);
+    AOT_STATUS(exp_, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(div_, -1);
+    AOT_PUSH_SMALL(0xff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_JUMP();
+
+    // 0x0922
+L_0922:
+    AOT_BLOCK(232, 3, 2);
+    AOT_PUSH_SMALL(0x2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(dup2, 1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x40);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x40);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STATUS(sload, 0);
+    AOT_STATE(dup2, 1);
+    AOT_JUMP();
+
+    // 0x0947
+L_0947:
+    AOT_BLOCK(206, 2, 5);
+    AOT_PUSH_SMALL(0x0);
+    AOT_PUSH_SMALL(0x1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup4, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_STATUS(sload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_JUMP();
+
+    // 0x0990
+L_0990:
+    AOT_BLOCK(394, 0, 9);
+    AOT_PUSH_SMALL(0x5);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(sload, 0);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STATE(dup2, 1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STACK(and_, -1);
+    AOT_STACK(iszero, 0);
+    AOT_PUSH_SMALL(0x100);
+    AOT_STACK(mul, -1);
+    AOT_STACK(sub, -1);
+    AOT_STACK(and_, -1);
+    AOT_PUSH_SMALL(0x2);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(div_, -1);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x1f);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(div_, -1);
+    AOT_STACK(mul, -1);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap3, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STATUS(sload, 0);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STATE(dup2, 1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STACK(and_, -1);
+    AOT_STACK(iszero, 0);
+    AOT_PUSH_SMALL(0x100);
+    AOT_STACK(mul, -1);
+    AOT_STACK(sub, -1);
+    AOT_STACK(and_, -1);
+    AOT_PUSH_SMALL(0x2);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(div_, -1);
+    AOT_STATE(dup1, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_0a26);
+
+    // 0x09e0
+    AOT_BLOCK(22, 1, 2);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x1f);
+    AOT_STACK(lt, -1);
+    AOT_STATIC_JUMPI(L_09fb);
+
+    // 0x09e8
+    AOT_BLOCK(148, 3, 3);
+    AOT_PUSH_SMALL(0x100);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup4, 1);
+    AOT_STATUS(sload, 0);
+    AOT_STACK(div_, -1);
+    AOT_STACK(mul, -1);
+    AOT_STATE(dup4, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(swap2, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    goto L_0a26;
+
+    // 0x09fb
+L_09fb:
+    AOT_BLOCK(58, 3, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_STATE(swap1, 0);
+
+    // 0x0a09
+L_0a09:
+    AOT_BLOCK(150, 3, 2);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(sload, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup4, 1);
+    AOT_STACK(gt, -1);
+    AOT_STATIC_JUMPI(L_0a09);
+
+    // 0x0a1d
+    AOT_BLOCK(24, 3, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(sub, -1);
+    AOT_PUSH_SMALL(0x1f);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup3, 1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+
+    // 0x0a26
+L_0a26:
+    AOT_BLOCK(22, 7, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup2, 1);
+    AOT_JUMP();
+
+    // 0x0a2e
+L_0a2e:
+    AOT_BLOCK(212, 1, 6);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup2, 1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(caller, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_STATUS(sload, 0);
+    AOT_STACK(lt, -1);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_0a7e);
+
+    // 0x0a7a
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x0a7e
+L_0a7e:
+    AOT_BLOCK(2020, 4, 8);
+    AOT_STATE(dup2, 1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(caller, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATUS(sload, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap3, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(swap1, 0);
+    AOT_GAS_CORRECTION(sstore, -2, 1811);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup2, 1);
+    AOT_PUSH_SMALL(0x1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup6, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATUS(sload, 0);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap3, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATE(swap1, 0);
+    AOT_GAS_CORRECTION(sstore, -2, 1600);
+    AOT_STACK(pop, -1);
+    AOT_STATE(dup3, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(caller, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0xddf252ad1be2c89b, 0x69c2b068fc378daa, 0x952ba7f163c4a116, 0x28f55a4df523b3ef);
+    AOT_STATE(dup5, 1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATUS(log3, -5);
+    AOT_PUSH_SMALL(0x1);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap3, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_JUMP();
+
+    // 0x0b87
+L_0b87:
+    AOT_BLOCK(286, 3, 5);
+    AOT_PUSH_SMALL(0x0);
+    AOT_PUSH_SMALL(0x2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup5, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup4, 1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_PUSH(0x0, 0xffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(keccak256, -1);
+    AOT_STATUS(sload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STATE(swap3, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_JUMP();
+
+    // 0x0c0e
+    AOT_BLOCK(0, 0, 0);
+    AOT_EXIT(EVMC_SUCCESS);
+
+    // 0x0c3a
+    AOT_BLOCK(1559, 19, 0);
+    AOT_STATUS(log1, -3);
+    AOT_PUSH_SMALL(0x627a7a723058);
+    AOT_STATUS(keccak256, -1);
+    AOT_STATUS(log0, -2);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_STACK(sub, -1);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_STATE(dup12, 1);
+    AOT_STACK(and_, -1);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_PUSH_SMALL(0x984cff3951);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_STATE(gaslimit, 1);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_STATE(dup15, 1);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_STATUS(log0, -2);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_PUSH_SMALL(0xd464aca0);
+    AOT_STATE(swap7, 0);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_PUSH(0x0, 0xdd, 0x29000000000000, 0x0);
+    AOT_EXIT(EVMC_SUCCESS);
+
+jump:
+    AOT_DISPATCH(destination)
+    {
+    case 0xaf:
+        goto L_00af;
+    case 0xb4:
+        goto L_00b4;
+    case 0xbf:
+        goto L_00bf;
+    case 0xc7:
+        goto L_00c7;
+    case 0xec:
+        goto L_00ec;
+    case 0x107:
+        goto L_0107;
+    case 0x134:
+        goto L_0134;
+    case 0x142:
+        goto L_0142;
+    case 0x14d:
+        goto L_014d;
+    case 0x182:
+        goto L_0182;
+    case 0x19c:
+        goto L_019c;
+    case 0x1a7:
+        goto L_01a7;
+    case 0x1af:
+        goto L_01af;
+    case 0x1c5:
+        goto L_01c5;
+    case 0x1d0:
+        goto L_01d0;
+    case 0x224:
+        goto L_0224;
+    case 0x23e:
+        goto L_023e;
+    case 0x249:
+        goto L_0249;
+    case 0x275:
+        goto L_0275;
+    case 0x28b:
+        goto L_028b;
+    case 0x296:
+        goto L_0296;
+    case 0x29e:
+        goto L_029e;
+    case 0x2ba:
+        goto L_02ba;
+    case 0x2c5:
+        goto L_02c5;
+    case 0x310:
+        goto L_0310;
+    case 0x326:
+        goto L_0326;
+    case 0x331:
+        goto L_0331;
+    case 0x35d:
+        goto L_035d;
+    case 0x373:
+        goto L_0373;
+    case 0x37e:
+        goto L_037e;
+    case 0x386:
+        goto L_0386;
+    case 0x3ab:
+        goto L_03ab;
+    case 0x3c6:
+        goto L_03c6;
+    case 0x3f3:
+        goto L_03f3;
+    case 0x401:
+        goto L_0401;
+    case 0x40c:
+        goto L_040c;
+    case 0x441:
+        goto L_0441;
+    case 0x45b:
+        goto L_045b;
+    case 0x466:
+        goto L_0466;
+    case 0x4b1:
+        goto L_04b1;
+    case 0x4c7:
+        goto L_04c7;
+    case 0x532:
+        goto L_0532;
+    case 0x540:
+        goto L_0540;
+    case 0x55d:
+        goto L_055d;
+    case 0x565:
+        goto L_0565;
+    case 0x657:
+        goto L_0657;
+    case 0x65d:
+        goto L_065d;
+    case 0x72e:
+        goto L_072e;
+    case 0x739:
+        goto L_0739;
+    case 0x886:
+        goto L_0886;
+    case 0x8f7:
+        goto L_08f7;
+    case 0x90f:
+        goto L_090f;
+    case 0x922:
+        goto L_0922;
+    case 0x947:
+        goto L_0947;
+    case 0x990:
+        goto L_0990;
+    case 0x9fb:
+        goto L_09fb;
+    case 0xa09:
+        goto L_0a09;
+    case 0xa26:
+        goto L_0a26;
+    case 0xa2e:
+        goto L_0a2e;
+    case 0xa7e:
+        goto L_0a7e;
+    case 0xb87:
+        goto L_0b87;
+    }
+    AOT_EXIT(EVMC_BAD_JUMP_DESTINATION);
+
+exit:
+    return aot_result(state, status);
+}
+
+const uint8_t aot_add_code[212] = {
+    0x60, 0x80, 0x60, 0x40, 0x52, 0x34, 0x80, 0x15, 0x61, 0x00, 0x10, 0x57, 0x60, 0x00, 0x80, 0xfd,
+    0x5b, 0x50, 0x60, 0xb5, 0x80, 0x61, 0x00, 0x1f, 0x60, 0x00, 0x39, 0x60, 0x00, 0xf3, 0x00, 0x60,
+    0x80, 0x60, 0x40, 0x52, 0x60, 0x04, 0x36, 0x10, 0x60, 0x3f, 0x57, 0x60, 0x00, 0x35, 0x7c, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x04, 0x63, 0xff,
+    0xff, 0xff, 0xff, 0x16, 0x80, 0x63, 0x10, 0x03, 0xe2, 0xd2, 0x14, 0x60, 0x44, 0x57, 0x5b, 0x60,
+    0x00, 0x80, 0xfd, 0x5b, 0x34, 0x80, 0x15, 0x60, 0x4f, 0x57, 0x60, 0x00, 0x80, 0xfd, 0x5b, 0x50,
+    0x60, 0x6c, 0x60, 0x04, 0x80, 0x36, 0x03, 0x81, 0x01, 0x90, 0x80, 0x80, 0x35, 0x90, 0x60, 0x20,
+    0x01, 0x90, 0x92, 0x91, 0x90, 0x50, 0x50, 0x50, 0x60, 0x82, 0x56, 0x5b, 0x60, 0x40, 0x51, 0x80,
+    0x82, 0x81, 0x52, 0x60, 0x20, 0x01, 0x91, 0x50, 0x50, 0x60, 0x40, 0x51, 0x80, 0x91, 0x03, 0x90,
+    0xf3, 0x5b, 0x60, 0x00, 0x91, 0x90, 0x50, 0x56, 0x00, 0xa1, 0x65, 0x62, 0x7a, 0x7a, 0x72, 0x30,
+    0x58, 0x20, 0xb2, 0xd9, 0x84, 0xd9, 0x22, 0x8e, 0x0c, 0xfe, 0x29, 0x50, 0xfb, 0x67, 0x58, 0x0e,
+    0x38, 0x2f, 0x88, 0xe8, 0x08, 0xe7, 0xbf, 0x9b, 0xe6, 0x77, 0xc7, 0x9d, 0xa2, 0x84, 0x26, 0xa4,
+    0xde, 0x94, 0x00, 0x29,
+};
+
+struct evmc_result aot_add(struct ExecutionState *state)
+{
+    struct uint256_t *bottom = StackSpace_bottom(&state->stack_space);
+    struct uint256_t *top = bottom;
+    struct uint256_t *destination;
+    enum evmc_status_code status;
+
+    // 0x0000
+    AOT_BLOCK(30, 0, 3);
+    AOT_PUSH_SMALL(0x80);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mstore, -2);
+    AOT_STATE(callvalue, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STACK(iszero, 0);
+    AOT_STATIC_JUMPI(L_0010);
+
+    // 0x000c
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x0010
+L_0010:
+    AOT_BLOCK(21, 1, 3);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0xb5);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x1f);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATUS(codecopy, -3);
+    AOT_PUSH_SMALL(0x0);
+    AOT_TERMINATE(return_);
+
+    // 0x001e
+    AOT_BLOCK(0, 0, 0);
+    AOT_EXIT(EVMC_SUCCESS);
+
+    // 0x001f
+    AOT_BLOCK(30, 0, 2);
+    AOT_PUSH_SMALL(0x80);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x4);
+    AOT_STATE(calldatasize, 1);
+    AOT_STACK(lt, -1);
+    AOT_BAD_JUMPI();
+
+    // 0x002b
+    AOT_BLOCK(45, 0, 3);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(calldataload, 0);
+    AOT_PUSH(0x100000000, 0x0, 0x0, 0x0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(div_, -1);
+    AOT_PUSH_SMALL(0xffffffff);
+    AOT_STACK(and_, -1);
+    AOT_STATE(dup1, 1);
+    AOT_PUSH_SMALL(0x1003e2d2);
+    AOT_STACK(eq, -1);
+    AOT_BAD_JUMPI();
+
+    // 0x005e
+L_005e:
+    AOT_BLOCK(7, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x0063
+L_0063:
+    AOT_BLOCK(22, 0, 3);
+    AOT_STATE(callvalue, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STACK(iszero, 0);
+    AOT_BAD_JUMPI();
+
+    // 0x006a
+    AOT_BLOCK(6, 0, 2);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(dup1, 1);
+    AOT_TERMINATE(revert);
+
+    // 0x006e
+L_006e:
+    AOT_BLOCK(73, 1, 5);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x6c);
+    AOT_PUSH_SMALL(0x4);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldatasize, 1);
+    AOT_STACK(sub, -1);
+    AOT_STATE(dup2, 1);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(calldataload, 0);
+    AOT_STATE(swap1, 0);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap1, 0);
+    AOT_STATE(swap3, 0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_EXIT(EVMC_BAD_JUMP_DESTINATION);
+
+    // 0x008b
+L_008b:
+    AOT_BLOCK(50, 1, 4);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(dup3, 1);
+    AOT_STATE(dup2, 1);
+    AOT_STATUS(mstore, -2);
+    AOT_PUSH_SMALL(0x20);
+    AOT_STACK(add, -1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(pop, -1);
+    AOT_STACK(pop, -1);
+    AOT_PUSH_SMALL(0x40);
+    AOT_STATUS(mload, 0);
+    AOT_STATE(dup1, 1);
+    AOT_STATE(swap2, 0);
+    AOT_STACK(sub, -1);
+    AOT_STATE(swap1, 0);
+    AOT_TERMINATE(return_);
+
+    // 0x00a1
+L_00a1:
+    AOT_BLOCK(20, 2, 1);
+    AOT_PUSH_SMALL(0x0);
+    AOT_STATE(swap2, 0);
+    AOT_STATE(swap1, 0);
+    AOT_STACK(pop, -1);
+    AOT_JUMP();
+
+    // 0x00a8
+    AOT_BLOCK(0, 0, 0);
+    AOT_EXIT(EVMC_SUCCESS);
+
+    // 0x00d4
+    AOT_BLOCK(800, 17, 0);
+    AOT_STATUS(log1, -3);
+    AOT_PUSH_SMALL(0x627a7a723058);
+    AOT_STATUS(keccak256, -1);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_STATE(dup5, 1);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_STATE(dup15, 1);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_EXIT(EVMC_INVALID_INSTRUCTION);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_STACK(pop, -1);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_PUSH_SMALL(0x580e382f88e808e7);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_STATE(swap12, 0);
+    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);
+    AOT_PUSH(0x0, 0xc79da28426a4de94, 0x29000000000000, 0x0);
+    AOT_EXIT(EVMC_SUCCESS);
+
+jump:
+    AOT_DISPATCH(destination)
+    {
+    case 0x10:
+        goto L_0010;
+    case 0x5e:
+        goto L_005e;
+    case 0x63:
+        goto L_0063;
+    case 0x6e:
+        goto L_006e;
+    case 0x8b:
+        goto L_008b;
+    case 0xa1:
+        goto L_00a1;
+    }
+    AOT_EXIT(EVMC_BAD_JUMP_DESTINATION);
+
+exit:
+    return aot_result(state, status);
+}
+
+const struct AotContract aot_contracts[] = {
+    {"erc20", 9, aot_erc20_code, 3537, 0xd8775d16f582130aULL, aot_erc20},
+    {"erc20_runtime", 9, aot_erc20_runtime_code, 3130, 0x826a31b10fd7cc95ULL, aot_erc20_runtime},
+    {"add", 9, aot_add_code, 212, 0x0f13c1be6412f49dULL, aot_add},
+};
@@ -0,0 +1,229 @@
+#pragma once
+
+#include "instructions.h"
+#include "execution_state_pool.h"
+
+/// The baseline interpreter: executes the bytecode directly, without the Instruction table
+/// built by analyze(). The only analysis is a single pass marking the valid jump destinations,
+/// which makes it the cheaper choice for calls executing few instructions of a large contract.
+/// Gas and stack requirements are checked per instruction.
+
+/// The analysis of the baseline interpreter.
+struct BaselineCodeAnalysis
+{
+    /// The code followed by 33 zero bytes, so the value of a truncated PUSH at the end of the
+    /// code reads as zeros and running off the end of the code executes STOP.
+    uint8_t *padded_code;
+
+    /// One bit per code offset, set for the JUMPDEST instructions (not the PUSH data).
+    uint64_t *jumpdest_bitmap;
+
+    size_t code_size;
+};
+
+struct BaselineCodeAnalysis analyze_baseline(uint8_t *code, size_t code_size)
+{
+    struct BaselineCodeAnalysis analysis;
+    analysis.code_size = code_size;
+    analysis.padded_code = (uint8_t *)malloc(code_size + 33);
+    memcpy(analysis.padded_code, code, code_size);
+    memset(analysis.padded_code + code_size, 0, 33);
+    analysis.jumpdest_bitmap = (uint64_t *)calloc((code_size + 63) / 64 + 1, sizeof(uint64_t));
+
+    for (size_t i = 0; i < code_size; ++i)
+    {
+        uint8_t opcode = code[i];
+        if (opcode >= OP_PUSH1 && opcode <= OP_PUSH32)
+            i += (size_t)(opcode - OP_PUSH1) + 1;
+        else if (opcode == OP_JUMPDEST)
+            analysis.jumpdest_bitmap[i / 64] |= (uint64_t)1 << (i % 64);
+    }
+    return analysis;
+}
+
+void BaselineCodeAnalysis_free(struct BaselineCodeAnalysis *analysis)
+{
+    free(analysis->padded_code);
+    free(analysis->jumpdest_bitmap);
+}
+
+/// Returns the code position of the jump destination, or NULL if it is not a JUMPDEST.
+uint8_t *baseline_jumpdest(struct BaselineCodeAnalysis *analysis, struct uint256_t *dst)
+{
+    if (WORD_P(dst, 3) != 0 || WORD_P(dst, 2) != 0 || WORD_P(dst, 1) != 0 || WORD_P(dst, 0) >= analysis->code_size)
+        return NULL;
+    size_t offset = (size_t)WORD_P(dst, 0);
+    if ((analysis->jumpdest_bitmap[offset / 64] & ((uint64_t)1 << (offset % 64))) == 0)
+        return NULL;
+    return analysis->padded_code + offset;
+}
+
+/// Generators of the switch cases for the instruction kinds of instructions_xmacro.h.
+/// The gas is charged before every instruction, so the GAS_CORRECTION instructions see the
+/// exact gas left without any correction.
+#define BASELINE_STACK(opcode, impl, change) \
+    case opcode: \
+        impl(makeStackTop(top)); \
+        top += (change); \
+        ++pos; \
+        break;
+
+#define BASELINE_STATE(opcode, impl, change) \
+    case opcode: \
+        impl(makeStackTop(top), state); \
+        top += (change); \
+        ++pos; \
+        break;
+
+#define BASELINE_STATUS(opcode, impl, change) \
+    case opcode: \
+        status = impl(makeStackTop(top), state); \
+        top += (change); \
+        if (status != EVMC_SUCCESS) \
+            goto exit; \
+        ++pos; \
+        break;
+
+#define BASELINE_GAS_CORRECTION(opcode, impl, change) BASELINE_STATUS(opcode, impl, change)
+
+/// The cases below are written by hand.
+#define BASELINE_CUSTOM(opcode, impl, change)
+
+struct evmc_result execute_baseline_analyzed(struct ExecutionState *state, struct BaselineCodeAnalysis *analysis)
+{
+    state->analysis.baseline = analysis;
+
+    const int16_t *costs = gas_costs[state->rev];
+    uint8_t *pos = analysis->padded_code;
+    struct uint256_t *bottom = StackSpace_bottom(&state->stack_space);
+    struct uint256_t *top = bottom;
+    enum evmc_status_code status;
+
+    for (;;)
+    {
+        uint8_t op = *pos;
+        if (costs[op] == undefined)
+        {
+            status = EVMC_UNDEFINED_INSTRUCTION;
+            goto exit;
+        }
+        int stack_size = (int)(top - bottom);
+        if (stack_size < traits[op].stack_height_required)
+        {
+            status = EVMC_STACK_UNDERFLOW;
+            goto exit;
+        }
+        if (stack_size + traits[op].stack_height_change > 1024)
+        {
+            status = EVMC_STACK_OVERFLOW;
+            goto exit;
+        }
+        if ((state->gas_left -= costs[op]) < 0)
+        {
+            status = EVMC_OUT_OF_GAS;
+            goto exit;
+        }
+
+        switch (op)
+        {
+#define X(opcode, identifier, impl, kind, required, change, since) BASELINE_##kind(opcode, impl, change)
+            MAP_OPCODE_TO_IDENTIFIER
+#undef X
+
+        case OP_STOP:
+            status = EVMC_SUCCESS;
+            goto exit;
+
+        case OP_JUMP:
+            if ((pos = baseline_jumpdest(analysis, top--)) == NULL)
+            {
+                status = EVMC_BAD_JUMP_DESTINATION;
+                goto exit;
+            }
+            break;
+
+        case OP_JUMPI:
+            top -= 2;
+            if (zero256(top + 1))
+                ++pos;
+            else if ((pos = baseline_jumpdest(analysis, top + 2)) == NULL)
+            {
+                status = EVMC_BAD_JUMP_DESTINATION;
+                goto exit;
+            }
+            break;
+
+        case OP_PC:
+            *++top = (struct uint256_t){0, 0, 0, (uint64_t)(pos - analysis->padded_code)};
+            ++pos;
+            break;
+
+        case OP_GAS:
+            *++top = (struct uint256_t){0, 0, 0, (uint64_t)state->gas_left};
+            ++pos;
+            break;
+
+        case OP_PUSH1 ... OP_PUSH8:
+        {
+            // The code is padded, the 8 bytes are there even for the last instruction.
+            size_t push_size = (size_t)(op - OP_PUSH1) + 1;
+            *++top = (struct uint256_t){0, 0, 0, load64be(pos + 1) >> (64 - 8 * push_size)};
+            pos += push_size + 1;
+            break;
+        }
+
+        case OP_PUSH9 ... OP_PUSH32:
+        {
+            size_t push_size = (size_t)(op - OP_PUSH1) + 1;
+            uint8_t buffer[32];
+            memset(buffer, 0, 32 - push_size);
+            memcpy(buffer + 32 - push_size, pos + 1, push_size);
+            load256be(buffer, ++top);
+            pos += push_size + 1;
+            break;
+        }
+
+        case OP_RETURN:
+            status = return_(makeStackTop(top), state).status;
+            goto exit;
+
+        case OP_REVERT:
+            status = revert(makeStackTop(top), state).status;
+            goto exit;
+
+        case OP_INVALID:
+            status = EVMC_INVALID_INSTRUCTION;
+            goto exit;
+
+        case OP_SELFDESTRUCT:
+            status = selfdestruct_(makeStackTop(top), state).status;
+            goto exit;
+        }
+    }
+
+exit:
+    state->status = status;
+    size_t gas_left = (status == EVMC_SUCCESS || status == EVMC_REVERT) ? state->gas_left : 0;
+    size_t output_size = (status == EVMC_SUCCESS || status == EVMC_REVERT) ? state->output_size : 0;
+
+    assert(state->output_size != 0 || state->output_offset == 0);
+    return evmc_make_result(status, gas_left, Memory_data(&(state->memory)) + state->output_offset, output_size);
+}
+
+#undef BASELINE_STACK
+#undef BASELINE_STATE
+#undef BASELINE_STATUS
+#undef BASELINE_GAS_CORRECTION
+#undef BASELINE_CUSTOM
+
+struct evmc_result execute_baseline(struct evmc_vm* vm, struct evmc_host_context *ctx, enum evmc_revision rev, struct evmc_message *msg, uint8_t *code, size_t code_size)
+{
+    struct BaselineCodeAnalysis analysis = analyze_baseline(code, code_size);
+    struct AdvancedExecutionState *astate = ExecutionStatePool_acquire(&execution_state_pool, msg, rev, ctx, code, code_size);
+
+    struct evmc_result result = execute_baseline_analyzed(&astate->estate, &analysis);
+
+    ExecutionStatePool_release(&execution_state_pool, astate);
+    BaselineCodeAnalysis_free(&analysis);
+    return result;
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <string.h>
+
+#include "uint256.h"
+
+/// The big-endian loads and stores of the EVM words: the 32-byte words of the memory, the
+/// calldata, the storage and the PUSH data, the 20-byte addresses and the 8-byte words.
+///
+/// A uint256_t has its most significant word first, so the 32-byte big-endian word is its
+/// four words each byte-swapped. The unaligned accesses are memcpy()s of a fixed size, which
+/// the compilers turn into single loads and stores, and the swaps into bswap (rev on Arm).
+
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define BYTE_ORDER_BSWAP 1
+#else
+#define BYTE_ORDER_BSWAP 0
+#endif
+
+static inline uint64_t load64be(const uint8_t *data)
+{
+#if BYTE_ORDER_BSWAP
+    uint64_t x;
+    memcpy(&x, data, 8);
+    return __builtin_bswap64(x);
+#else
+    return ((uint64_t)data[0] << 56) | ((uint64_t)data[1] << 48) | ((uint64_t)data[2] << 40) |
+           ((uint64_t)data[3] << 32) | ((uint64_t)data[4] << 24) | ((uint64_t)data[5] << 16) |
+           ((uint64_t)data[6] << 8) | (uint64_t)data[7];
+#endif
+}
+
+static inline uint32_t load32be(const uint8_t *data)
+{
+#if BYTE_ORDER_BSWAP
+    uint32_t x;
+    memcpy(&x, data, 4);
+    return __builtin_bswap32(x);
+#else
+    return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | (uint32_t)data[3];
+#endif
+}
+
+static inline void store64be(uint8_t *data, uint64_t x)
+{
+#if BYTE_ORDER_BSWAP
+    x = __builtin_bswap64(x);
+    memcpy(data, &x, 8);
+#else
+    for (int i = 7; i >= 0; --i, x >>= 8)
+        data[i] = (uint8_t)x;
+#endif
+}
+
+static inline void store32be(uint8_t *data, uint32_t x)
+{
+#if BYTE_ORDER_BSWAP
+    x = __builtin_bswap32(x);
+    memcpy(data, &x, 4);
+#else
+    for (int i = 3; i >= 0; --i, x >>= 8)
+        data[i] = (uint8_t)x;
+#endif
+}
+
+/// Loads the 32-byte big-endian word.
+static inline void load256be(const uint8_t *data, struct uint256_t *x)
+{
+    WORD_P(x, 3) = load64be(data);
+    WORD_P(x, 2) = load64be(data + 8);
+    WORD_P(x, 1) = load64be(data + 16);
+    WORD_P(x, 0) = load64be(data + 24);
+}
+
+static inline void store256be(uint8_t *data, const struct uint256_t *x)
+{
+    store64be(data, WORD_P(x, 3));
+    store64be(data + 8, WORD_P(x, 2));
+    store64be(data + 16, WORD_P(x, 1));
+    store64be(data + 24, WORD_P(x, 0));
+}
+
+/// Loads the 20-byte big-endian address, zero-extended.
+static inline void load160be(const uint8_t *data, struct uint256_t *x)
+{
+    WORD_P(x, 3) = 0;
+    WORD_P(x, 2) = load32be(data);
+    WORD_P(x, 1) = load64be(data + 4);
+    WORD_P(x, 0) = load64be(data + 12);
+}
+
+/// Stores the low 160 bits, the address of the word.
+static inline void store160be(uint8_t *data, const struct uint256_t *x)
+{
+    store32be(data, (uint32_t)WORD_P(x, 2));
+    store64be(data + 4, WORD_P(x, 1));
+    store64be(data + 12, WORD_P(x, 0));
+}
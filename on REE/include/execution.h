@@ -1,6 +1,6 @@
 #pragma once
 
-#include "analysis_impl.h"
+#include "aot.h"
 
 struct evmc_result execute_analyzed_code(struct AdvancedExecutionState *astate, struct CodeAnalysis *analysis)
 {
@@ -9,7 +9,7 @@ struct evmc_result execute_analyzed_code(struct AdvancedExecutionState *astate,
     state->analysis.advanced = analysis;
 
     // Start with the first instruction.
-    struct Instruction *instr = cvec_instr_begin(&state->analysis.advanced->instrs).ref;
+    struct Instruction *instr = state->analysis.advanced->instrs;
     while (instr != NULL){
         instr = instr->fn(instr, astate);
     }
@@ -19,10 +19,384 @@ struct evmc_result execute_analyzed_code(struct AdvancedExecutionState *astate,
     return evmc_make_result(state->status, gas_left, Memory_data(&(state->memory)) + state->output_offset, state->output_size);
 }
 
+#if defined(__GNUC__)
+/// Executes the analyzed code with direct threaded dispatch (GCC labels as values).
+///
+/// The instruction pointer, the stack top and the gas counter stay in locals for the whole
+/// execution. The most frequent instructions are executed inline, all other ones go through
+/// their instruction_exec_fn with the locals written back to astate around the call.
+///
+/// The top stack item is cached in the local tos, the memory slot under top is stale while
+/// it is cached. The cache is spilled only before a call to an instruction_exec_fn (host
+/// calls included) and at exit, so DUP/PUSH/SWAP and the arithmetic on the top item avoid
+/// the round trip through the stack space. With an empty stack tos mirrors the bottom slot.
+struct evmc_result execute_analyzed_code_threaded(struct AdvancedExecutionState *astate, struct CodeAnalysis *analysis)
+{
+    static const void *const labels[256] = {
+        [0 ... 255] = &&generic,
+        [OP_STOP] = &&stop,
+        [OP_ADD] = &&add,
+        [OP_MUL] = &&mul,
+        [OP_SUB] = &&sub,
+        [OP_LT] = &&lt,
+        [OP_GT] = &&gt,
+        [OP_EQ] = &&eq,
+        [OP_ISZERO] = &&iszero,
+        [OP_AND] = &&and,
+        [OP_OR] = &&or,
+        [OP_XOR] = &&xor,
+        [OP_NOT] = &&not,
+        [OP_POP] = &&pop,
+        [OP_JUMP] = &&jump,
+        [OP_JUMPI] = &&jumpi,
+        [OPX_BEGINBLOCK] = &&beginblock,
+        [OPX_AND_ADDRESS] = &&and_address,
+        [OPX_ISZERO_ISZERO] = &&iszero_iszero,
+        [OPX_SELECTOR_JUMPI] = &&selector_jumpi,
+        [OPX_SELECTOR_DISPATCH] = &&selector_dispatch,
+        [OPX_STATIC_JUMP] = &&static_jump,
+        [OPX_STATIC_JUMPI] = &&static_jumpi,
+        [OPX_SUPERBLOCK] = &&superblock,
+        [OPX_SUPERBLOCK_JUMPI] = &&superblock_jumpi,
+        [OPX_SUPERBLOCK_STATIC_JUMPI] = &&superblock_static_jumpi,
+        [OPX_SUPERBLOCK_JUMP] = &&superblock_jump,
+        [OP_PUSH1 ... OP_PUSH8] = &&push_small,
+        [OP_PUSH9 ... OP_PUSH32] = &&push_full,
+        [OP_DUP1 ... OP_DUP16] = &&dup,
+        [OP_SWAP1 ... OP_SWAP16] = &&swap,
+    };
+
+    struct ExecutionState* state = &astate->estate;
+    // Allow accessing the analysis by instructions.
+    state->analysis.advanced = analysis;
+
+    struct Instruction *begin = analysis->instrs;
+    const uint8_t *opcodes = analysis->opcodes;
+    struct Instruction *instr = begin;
+    struct uint256_t *top = astate->stack.top_item;
+    struct uint256_t tos = *top;
+    int64_t gas_left = state->gas_left;
+    uint8_t opcode;
+    enum evmc_status_code status;
+
+#define DISPATCH() do { opcode = opcodes[instr - begin]; goto *labels[opcode]; } while (0)
+#define NEXT() do { ++instr; DISPATCH(); } while (0)
+
+    DISPATCH();
+
+generic:
+    *top = tos;
+    astate->stack.top_item = top;
+    state->gas_left = gas_left;
+    instr = instr->fn(instr, astate);
+    if (instr == NULL)
+        goto done;
+    top = astate->stack.top_item;
+    tos = *top;
+    gas_left = state->gas_left;
+    DISPATCH();
+
+beginblock:
+{
+    struct BlockInfo block = instr->arg.block;
+    if ((gas_left -= (int64_t)block.gas_cost) < 0)
+    {
+        status = EVMC_OUT_OF_GAS;
+        goto exit;
+    }
+    int stack_size = (int)(top - astate->stack.m_bottom);
+    if (stack_size < block.stack_req)
+    {
+        status = EVMC_STACK_UNDERFLOW;
+        goto exit;
+    }
+    if (stack_size + block.stack_max_growth > 1024)
+    {
+        status = EVMC_STACK_OVERFLOW;
+        goto exit;
+    }
+    astate->current_block_cost = block.gas_cost;
+    NEXT();
+}
+
+stop:
+    status = EVMC_SUCCESS;
+    goto exit;
+
+add:
+    add256(&tos, top - 1, &tos);
+    --top;
+    NEXT();
+
+mul:
+    mul256(&tos, top - 1, &tos);
+    --top;
+    NEXT();
+
+sub:
+    minus256(&tos, top - 1, &tos);
+    --top;
+    NEXT();
+
+lt:
+    tos = (struct uint256_t){0, 0, 0, gt256(top - 1, &tos)};
+    --top;
+    NEXT();
+
+gt:
+    tos = (struct uint256_t){0, 0, 0, gt256(&tos, top - 1)};
+    --top;
+    NEXT();
+
+eq:
+    tos = (struct uint256_t){0, 0, 0, equal256(&tos, top - 1)};
+    --top;
+    NEXT();
+
+iszero:
+    tos = (struct uint256_t){0, 0, 0, zero256(&tos)};
+    NEXT();
+
+and:
+    and256(&tos, top - 1, &tos);
+    --top;
+    NEXT();
+
+or:
+    or256(&tos, top - 1, &tos);
+    --top;
+    NEXT();
+
+xor:
+    xor256(&tos, top - 1, &tos);
+    --top;
+    NEXT();
+
+not:
+    not256(&tos, &tos);
+    NEXT();
+
+pop:
+    tos = *--top;
+    NEXT();
+
+push_small:
+    *top++ = tos;
+    tos = (struct uint256_t){0, 0, 0, instr->arg.small_push_value};
+    NEXT();
+
+push_full:
+    *top++ = tos;
+    tos = *instr->arg.push_value;
+    NEXT();
+
+dup:
+    *top++ = tos;
+    tos = *(top - (opcode - OP_DUP1 + 1));
+    NEXT();
+
+swap:
+{
+    struct uint256_t tmp = tos;
+    tos = *(top - (opcode - OP_SWAP1 + 1));
+    *(top - (opcode - OP_SWAP1 + 1)) = tmp;
+    NEXT();
+}
+
+jumpi:
+    if (zero256(top - 1))
+    {
+        top -= 2;
+        tos = *top;
+        NEXT();
+    }
+    // Fall through to the jump, the condition is popped together with the destination.
+    --top;
+
+jump:
+{
+    struct uint256_t dst = tos;
+    tos = *--top;
+    int pc = -1;
+    if (WORD(dst, 3) != 0 || WORD(dst, 2) != 0 || WORD(dst, 1) != 0 || WORD(dst, 0) > INT_MAX ||
+        (pc = resolve_jumpdest(state, (int)WORD(dst, 0))) < 0)
+    {
+        status = EVMC_BAD_JUMP_DESTINATION;
+        goto exit;
+    }
+    // Reaching a new destination extends a lazy analysis, which may move the instructions.
+    begin = analysis->instrs;
+    opcodes = analysis->opcodes;
+    instr = begin + pc;
+    DISPATCH();
+}
+
+and_address:
+    WORD(tos, 3) = 0;
+    WORD(tos, 2) &= 0xffffffff;
+    NEXT();
+
+iszero_iszero:
+    tos = (struct uint256_t){0, 0, 0, !zero256(&tos)};
+    NEXT();
+
+selector_jumpi:
+{
+    if (WORD(tos, 3) != 0 || WORD(tos, 2) != 0 || WORD(tos, 1) != 0 || WORD(tos, 0) != instr->arg.selector_jump.selector)
+        NEXT();
+    if (instr->arg.selector_jump.dest < 0)
+    {
+        status = EVMC_BAD_JUMP_DESTINATION;
+        goto exit;
+    }
+    instr = begin + instr->arg.selector_jump.dest;
+    DISPATCH();
+}
+
+selector_dispatch:
+{
+    const struct SelectorSlot *slot = selector_dispatch_find(analysis, instr->arg, &tos);
+    if (slot->gas > gas_left)
+        NEXT();
+    gas_left -= slot->gas;
+    if (slot->dest < 0)
+    {
+        status = EVMC_BAD_JUMP_DESTINATION;
+        goto exit;
+    }
+    instr = begin + slot->dest;
+    DISPATCH();
+}
+
+static_jumpi:
+{
+    bool cond = !zero256(&tos);
+    tos = *--top;
+    if (!cond)
+        NEXT();
+}
+    // Fall through to the jump, the condition has been popped.
+
+static_jump:
+    if (instr->arg.number < 0)
+    {
+        status = EVMC_BAD_JUMP_DESTINATION;
+        goto exit;
+    }
+    instr = begin + instr->arg.number;
+    DISPATCH();
+
+superblock:
+{
+    const struct Superblock *superblock = &analysis->superblocks[instr->arg.number];
+    struct BlockInfo block = superblock->block;
+    if ((gas_left -= (int64_t)block.gas_cost) < 0)
+    {
+        status = EVMC_OUT_OF_GAS;
+        goto exit;
+    }
+    astate->current_block_cost = block.gas_cost;
+    int stack_size = (int)(top - astate->stack.m_bottom);
+    if (stack_size >= superblock->stack_req && stack_size + superblock->stack_max_growth <= 1024)
+    {
+        instr = begin + superblock->fast;
+        DISPATCH();
+    }
+    if (stack_size < block.stack_req)
+    {
+        status = EVMC_STACK_UNDERFLOW;
+        goto exit;
+    }
+    if (stack_size + block.stack_max_growth > 1024)
+    {
+        status = EVMC_STACK_OVERFLOW;
+        goto exit;
+    }
+    NEXT();
+}
+
+superblock_static_jumpi:
+{
+    bool cond = !zero256(&tos);
+    tos = *--top;
+    if (cond)
+    {
+        if (instr->arg.superblock_jump.dest < 0)
+        {
+            status = EVMC_BAD_JUMP_DESTINATION;
+            goto exit;
+        }
+        instr = begin + instr->arg.superblock_jump.dest;
+        DISPATCH();
+    }
+    goto superblock_jump;
+}
+
+superblock_jumpi:
+    if (!zero256(top - 1))
+    {
+        --top;
+        goto jump;
+    }
+    top -= 2;
+    tos = *top;
+    // Fall through to the next block of the superblock.
+
+superblock_jump:
+{
+    uint32_t gas_cost = instr->arg.superblock_jump.gas_cost;
+    if ((gas_left -= (int64_t)gas_cost) < 0)
+    {
+        status = EVMC_OUT_OF_GAS;
+        goto exit;
+    }
+    astate->current_block_cost = gas_cost;
+    NEXT();
+}
+
+exit:
+    *top = tos;
+    astate->stack.top_item = top;
+    state->gas_left = gas_left;
+    AdvancedExecutionState_exit(astate, status);
+
+done:
+#undef NEXT
+#undef DISPATCH
+    ;
+    size_t gas_left_result = (state->status == EVMC_SUCCESS || state->status == EVMC_REVERT) ? state->gas_left : 0;
+
+    assert(state->output_size != 0 || state->output_offset == 0);
+    return evmc_make_result(state->status, gas_left_result, Memory_data(&(state->memory)) + state->output_offset, state->output_size);
+}
+#else
+/// Labels as values are a GNU extension, other compilers use the regular dispatch loop.
+struct evmc_result execute_analyzed_code_threaded(struct AdvancedExecutionState *astate, struct CodeAnalysis *analysis)
+{
+    return execute_analyzed_code(astate, analysis);
+}
+#endif
+
 struct evmc_result execute(struct evmc_vm* vm, struct evmc_host_context *ctx, enum evmc_revision rev, struct evmc_message *msg, uint8_t *code, size_t code_size)
 {
-    struct CodeAnalysis analysis = analyze(rev, code, code_size);
-    struct AdvancedExecutionState* astate = (struct AdvancedExecutionState*)malloc(sizeof(struct AdvancedExecutionState));
-    AdvancedExecutionState_init_v(astate, msg, rev, ctx, code, code_size);
-    return execute_analyzed_code(astate, &analysis);
+    const struct AotContract *contract = aot_find(rev, code, code_size);
+    if (contract != NULL)
+        return execute_aot(contract, ctx, rev, msg, code, code_size);
+    struct CodeAnalysis *analysis = AnalysisCache_get(&analysis_cache, rev, code, code_size);
+    struct AdvancedExecutionState* astate = ExecutionStatePool_acquire(&execution_state_pool, msg, rev, ctx, code, code_size);
+    struct evmc_result result = execute_analyzed_code(astate, analysis);
+    ExecutionStatePool_release(&execution_state_pool, astate);
+    return result;
+}
+
+struct evmc_result execute_threaded(struct evmc_vm* vm, struct evmc_host_context *ctx, enum evmc_revision rev, struct evmc_message *msg, uint8_t *code, size_t code_size)
+{
+    const struct AotContract *contract = aot_find(rev, code, code_size);
+    if (contract != NULL)
+        return execute_aot(contract, ctx, rev, msg, code, code_size);
+    struct CodeAnalysis *analysis = AnalysisCache_get(&analysis_cache, rev, code, code_size);
+    struct AdvancedExecutionState* astate = ExecutionStatePool_acquire(&execution_state_pool, msg, rev, ctx, code, code_size);
+    struct evmc_result result = execute_analyzed_code_threaded(astate, analysis);
+    ExecutionStatePool_release(&execution_state_pool, astate);
+    return result;
 }
\ No newline at end of file
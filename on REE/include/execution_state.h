@@ -1,39 +1,68 @@
 #pragma once
 
 #include <stdio.h>
+#include <stddef.h>
 #include <assert.h>
 
 #include "mocked_host.h"
 #include "uint256.h"
 
+/// The memory of the normal-world build is a range of virtual memory reserved with
+/// mmap(PROT_NONE) and made accessible as it grows: the growth neither moves nor copies the
+/// data, the pages are zero when first touched and the range past the capacity is a guard.
+/// Elsewhere, or if the reservation fails, the memory is allocated with realloc().
+#ifndef MEMORY_MMAP
+#if defined(__linux__)
+#define MEMORY_MMAP 1
+#else
+#define MEMORY_MMAP 0
+#endif
+#endif
+
+#if MEMORY_MMAP
+#include <sys/mman.h>
+#endif
+
 /// Provides memory for EVM stack.
 struct StackSpace
 {
     /// The storage allocated for maximum possible number of items.
     /// Items are aligned to 256 bits for better packing in cache lines.
-    struct uint256_t m_stack_space[1024];
+    /// The first slot is the "bottom": it never holds an item, but it is writable so the
+    /// threaded interpreter can spill its cached top item even when the stack is empty.
+    struct uint256_t m_stack_space[1 + 1024];
 };
 
-/// Returns the pointer to the "bottom", i.e. below the stack space.
+/// Returns the pointer to the "bottom", i.e. the slot below the first stack item.
 struct uint256_t *StackSpace_bottom(struct StackSpace *stackspace)
 {
-    return stackspace->m_stack_space - 1;
+    return stackspace->m_stack_space;
 }
 
+/// The virtual memory reserved for the memory of an execution. A memory growing past it is
+/// moved to a larger reservation, which takes more gas than any transaction has.
+#ifndef MEMORY_RESERVATION
+#define MEMORY_RESERVATION ((size_t)64 * 1024 * 1024)
+#endif
+
+/// The size of allocation "page" of the memory.
+#define MEMORY_PAGE_SIZE (4 * 1024)
+
 /// The EVM memory.
 ///
 /// The implementations uses initial allocation of 4k and then grows capacity with 2x factor.
 /// Some benchmarks has been done to confirm 4k is ok-ish value.
 struct Memory
 {
-    /// The size of allocation "page".
-    size_t page_size;
     /// Pointer to allocated memory.
     uint8_t *m_data;
     /// The "virtual" size of the memory.
     size_t m_size;
     /// The size of allocated memory. The initialization value is the initial capacity.
     size_t m_capacity;
+    /// The size of the mmap() reservation, 0 if the memory is allocated with realloc().
+    /// The bytes of the reservation past m_size are always zero.
+    size_t m_reserved;
 };
 
 void Memory_handle_out_of_memory(struct Memory *memory)
@@ -42,8 +71,37 @@ void Memory_handle_out_of_memory(struct Memory *memory)
     exit(1);
 }
 
+#if MEMORY_MMAP
+/// Reserves the virtual memory of the given size, inaccessible. Returns NULL on failure.
+uint8_t *Memory_reserve(size_t size)
+{
+    void *data = mmap(NULL, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    return data != MAP_FAILED ? (uint8_t *)data : NULL;
+}
+#endif
+
 void Memory_allocate_capacity(struct Memory *memory)
 {
+#if MEMORY_MMAP
+    if (memory->m_reserved != 0)
+    {
+        if (memory->m_capacity > memory->m_reserved)
+        {
+            size_t reserved = 2 * memory->m_reserved > memory->m_capacity ? 2 * memory->m_reserved : memory->m_capacity;
+            uint8_t *data = Memory_reserve(reserved);
+            if (data == NULL || mprotect(data, memory->m_capacity, PROT_READ | PROT_WRITE) != 0)
+                Memory_handle_out_of_memory(memory);
+            memcpy(data, memory->m_data, memory->m_size);
+            munmap(memory->m_data, memory->m_reserved);
+            memory->m_data = data;
+            memory->m_reserved = reserved;
+        }
+        // The reservation starts at a page boundary, the system rounds the end up to one.
+        else if (mprotect(memory->m_data, memory->m_capacity, PROT_READ | PROT_WRITE) != 0)
+            Memory_handle_out_of_memory(memory);
+        return;
+    }
+#endif
     memory->m_data = (uint8_t*)realloc(memory->m_data, memory->m_capacity);
     if (memory->m_data == NULL)
         Memory_handle_out_of_memory(memory);
@@ -52,10 +110,15 @@ void Memory_allocate_capacity(struct Memory *memory)
 /// Creates Memory object with initial capacity allocation.
 void Memory_init(struct Memory *memory)
 {
-    memory->page_size = 4 * 1024;
     memory->m_data = NULL;
     memory->m_size = 0;
-    memory->m_capacity = memory->page_size;
+    memory->m_capacity = MEMORY_PAGE_SIZE;
+    memory->m_reserved = 0;
+#if MEMORY_MMAP
+    memory->m_data = Memory_reserve(MEMORY_RESERVATION);
+    if (memory->m_data != NULL)
+        memory->m_reserved = MEMORY_RESERVATION;
+#endif
     Memory_allocate_capacity(memory);
     
 }
@@ -63,6 +126,13 @@ void Memory_init(struct Memory *memory)
 /// Frees all allocated memory.
 void Memory_free(struct Memory *memory)
 {
+#if MEMORY_MMAP
+    if (memory->m_reserved != 0)
+    {
+        munmap(memory->m_data, memory->m_reserved);
+        return;
+    }
+#endif
     free(memory->m_data);
 }
 
@@ -99,21 +169,53 @@ void Memory_grow(struct Memory *memory, size_t new_size)
         // If not enough.
         if (memory->m_capacity < new_size)
         {
-            // Set capacity to required size rounded to multiple of page_size.
-            memory->m_capacity = ((new_size + (memory->page_size - 1)) / memory->page_size) * memory->page_size;
+            // Set capacity to required size rounded to multiple of MEMORY_PAGE_SIZE.
+            memory->m_capacity = ((new_size + (MEMORY_PAGE_SIZE - 1)) / MEMORY_PAGE_SIZE) * MEMORY_PAGE_SIZE;
         }
         Memory_allocate_capacity(memory);
     }
-    memset(memory->m_data + memory->m_size, 0, new_size - memory->m_size);
+    // The extension of a reservation is zero already.
+    if (memory->m_reserved == 0)
+        memset(memory->m_data + memory->m_size, 0, new_size - memory->m_size);
     memory->m_size = new_size;
 }
 
 /// Virtually clears the memory by setting its size to 0. The capacity stays unchanged.
 void Memory_clear(struct Memory *memory)
 {
+#if MEMORY_MMAP
+    // The bytes past the size of a reservation have to stay zero. The memset() is cheaper
+    // than discarding the pages, which are faulted in again by the next execution.
+    if (memory->m_reserved != 0)
+        memset(memory->m_data, 0, memory->m_size);
+#endif
     memory->m_size = 0;
 }
 
+/// Clears the memory and gives back its capacity past the given one, a multiple of MEMORY_PAGE_SIZE.
+void Memory_trim(struct Memory *memory, size_t capacity)
+{
+    if (memory->m_capacity <= capacity)
+    {
+        Memory_clear(memory);
+        return;
+    }
+#if MEMORY_MMAP
+    // The reservation is kept, only the pages past the capacity are discarded.
+    if (memory->m_reserved != 0)
+    {
+        memset(memory->m_data, 0, memory->m_size < capacity ? memory->m_size : capacity);
+        madvise(memory->m_data + capacity, memory->m_capacity - capacity, MADV_DONTNEED);
+        mprotect(memory->m_data + capacity, memory->m_capacity - capacity, PROT_NONE);
+        memory->m_capacity = capacity;
+        memory->m_size = 0;
+        return;
+    }
+#endif
+    Memory_free(memory);
+    Memory_init(memory);
+}
+
 //-------------ExecutionState-------------
 typedef uint8_t* bytes;
 
@@ -135,47 +237,67 @@ void bytes_view_init_v(struct bytes_view *bv, uint8_t *byte, uint64_t size)
     bv->size = size;
 }
 
+/// The data of the execution the instructions rarely access, out of the cache lines of the
+/// hot fields of ExecutionState.
+struct ExecutionStateCold
+{
+    /// The tx context, fetched from the host on the first use, see ExecutionState_get_tx_context().
+    struct evmc_tx_context m_tx;
+};
+
 /// Generic execution state for generic instructions implementations.
 struct ExecutionState
 {
+    /// The fields accessed by most instructions, in the first 64 bytes. The AdvancedExecutionState
+    /// aligns the ExecutionState to a cache line, so these are one line.
     int64_t gas_left;
     struct Memory memory;
     struct evmc_message *msg;
-    // struct HostContext host;
-    struct evmc_host_context host_ctx;
+
+    /// The host of the execution, not owned, and the methods to call it with.
+    struct evmc_host_context *host_ctx;
+    const struct HostInterface *host;
+
     enum evmc_revision rev;
+    enum evmc_status_code status;
     bytes return_data;
 
     /// Reference to original EVM code.
     /// TODO: Code should be accessed via code analysis only and this should be removed.
     bytes_view code;
 
-    enum evmc_status_code status;
     size_t output_offset;
     size_t output_size;
 
-    struct evmc_tx_context m_tx;
-
     /// Pointer to code analysis.
     /// This should be set and used internally by execute() function of a particular interpreter.
     union
     {
         struct CodeAnalysis *advanced;
+        struct BaselineCodeAnalysis *baseline;
     } analysis;
 
+    /// Owned, allocated by ExecutionState_init_v().
+    struct ExecutionStateCold *cold;
+
     /// Stack space allocation.
     ///
     /// This is the last field to make other fields' offsets of reasonable values.
     struct StackSpace stack_space;
 };
 
+/// The hot fields in 64 bytes, the line itself is checked with the AdvancedExecutionState.
+_Static_assert(offsetof(struct ExecutionState, host) + sizeof(const struct HostInterface *) <= 64,
+               "the hot fields of ExecutionState must fit in its first 64 bytes");
+
 void ExecutionState_init(struct ExecutionState* execution_state)
 {
     execution_state->gas_left = 0;
     Memory_init(&execution_state->memory);
     execution_state->msg = NULL;
 
-    MockedHost_init(&execution_state->host_ctx);
+    execution_state->host_ctx = NULL;
+    execution_state->host = &mocked_host_interface;
     execution_state->rev = EVMC_LONDON;
     execution_state->return_data = NULL;
 
@@ -184,6 +306,9 @@ void ExecutionState_init(struct ExecutionState* execution_state)
     execution_state->status = EVMC_SUCCESS;
     execution_state->output_offset = 0;
     execution_state->output_size = 0;
+
+    execution_state->cold = (struct ExecutionStateCold *)malloc(sizeof(struct ExecutionStateCold));
+    memset(&execution_state->cold->m_tx, 0, sizeof(execution_state->cold->m_tx));
 }
 
 void ExecutionState_init_v(struct ExecutionState* execution_state, struct evmc_message* message, enum evmc_revision revision, struct evmc_host_context* host_ctx, uint8_t* code, size_t code_size)
@@ -192,7 +317,8 @@ void ExecutionState_init_v(struct ExecutionState* execution_state, struct evmc_m
     Memory_init(&execution_state->memory);
     execution_state->msg = message;
     
-    execution_state->host_ctx = *host_ctx;
+    execution_state->host_ctx = host_ctx;
+    execution_state->host = &mocked_host_interface;
     execution_state->rev = revision;
     execution_state->return_data = NULL;
     execution_state->code.data = code;
@@ -201,15 +327,22 @@ void ExecutionState_init_v(struct ExecutionState* execution_state, struct evmc_m
     execution_state->status = EVMC_SUCCESS;
     execution_state->output_offset = 0;
     execution_state->output_size = 0;
+    execution_state->analysis.advanced = NULL;
+
+    execution_state->cold = (struct ExecutionStateCold *)malloc(sizeof(struct ExecutionStateCold));
+    memset(&execution_state->cold->m_tx, 0, sizeof(execution_state->cold->m_tx));
 }
 
+/// Reinitializes the state of a finished execution for the next one, keeping the capacity
+/// of the memory and the cold data allocation.
 void ExecutionState_reset(struct ExecutionState* execution_state, struct evmc_message* message, enum evmc_revision revision, struct evmc_host_context* host_ctx, uint8_t* code, size_t code_size)
 {
     execution_state->gas_left = message->gas;
     Memory_clear(&execution_state->memory);
     execution_state->msg = message;
     
-    MockedHost_init(host_ctx);
+    execution_state->host_ctx = host_ctx;
+    execution_state->host = &mocked_host_interface;
     execution_state->rev = revision;
     execution_state->return_data = NULL;
     execution_state->code.data = code;
@@ -219,7 +352,15 @@ void ExecutionState_reset(struct ExecutionState* execution_state, struct evmc_me
     execution_state->output_offset = 0;
     execution_state->output_size = 0;
     execution_state->analysis.advanced = NULL;
-    evmcContext_init(execution_state->m_tx);
+    // Fetched again from the host of this execution, see ExecutionState_get_tx_context().
+    memset(&execution_state->cold->m_tx, 0, sizeof(execution_state->cold->m_tx));
+}
+
+/// Frees the memory and the cold data of the state.
+void ExecutionState_free(struct ExecutionState* execution_state)
+{
+    Memory_free(&execution_state->memory);
+    free(execution_state->cold);
 }
 
 bool ExecutionState_in_static_mode(struct ExecutionState* execution_state){
@@ -227,9 +368,11 @@ bool ExecutionState_in_static_mode(struct ExecutionState* execution_state){
     // return false;
 }
 
-struct evmc_tx_context ExecutionState_get_tx_context(struct ExecutionState* execution_state)
+/// Returns the tx context of the execution, fetched from the host once.
+const struct evmc_tx_context *ExecutionState_get_tx_context(struct ExecutionState* execution_state)
 {
-    if(execution_state->m_tx.block_timestamp == 0)
-        execution_state->m_tx = get_tx_context(&execution_state->host_ctx);
-    return execution_state->m_tx;
+    struct evmc_tx_context *tx = &execution_state->cold->m_tx;
+    if(tx->block_timestamp == 0)
+        *tx = execution_state->host->get_tx_context(execution_state->host_ctx);
+    return tx;
 }
\ No newline at end of file
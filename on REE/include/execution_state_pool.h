@@ -0,0 +1,67 @@
+#pragma once
+
+#include "analysis.h"
+
+/// The number of idle execution states kept for the next executions.
+#ifndef EXECUTION_STATE_POOL_SIZE
+#define EXECUTION_STATE_POOL_SIZE 4
+#endif
+
+/// The memory capacity an idle state keeps. A state released with more gives the rest back,
+/// see Memory_trim().
+#ifndef EXECUTION_STATE_POOL_MEMORY_LIMIT
+#define EXECUTION_STATE_POOL_MEMORY_LIMIT (256 * 1024)
+#endif
+
+/// The execution states of the finished executions, reused by the next ones instead of
+/// allocating the 32 KB stack space and the memory on every call.
+///
+/// The states are AdvancedExecutionStates, the baseline interpreter and the translated
+/// contracts use their ExecutionState. A nested execution acquires a state of its own.
+struct ExecutionStatePool
+{
+    struct AdvancedExecutionState *idle[EXECUTION_STATE_POOL_SIZE];
+    size_t size;
+
+    uint64_t allocations;
+    uint64_t reuses;
+};
+
+/// The pool shared by all executions. In the TA it lives as long as the TA instance, like
+/// the analysis cache.
+struct ExecutionStatePool execution_state_pool;
+
+/// Returns a state initialized for the execution, to be given back with
+/// ExecutionStatePool_release() once the result has been made.
+struct AdvancedExecutionState *ExecutionStatePool_acquire(struct ExecutionStatePool *pool, struct evmc_message *msg, enum evmc_revision rev, struct evmc_host_context *ctx, uint8_t *code, size_t code_size)
+{
+    struct AdvancedExecutionState *state;
+    if (pool->size != 0)
+    {
+        state = pool->idle[--pool->size];
+        AdvancedExecutionState_reset(state, msg, rev, ctx, code, code_size);
+        ++pool->reuses;
+    }
+    else
+    {
+        // Aligned for the cache lines of the hot fields, the size is a multiple of the alignment.
+        state = (struct AdvancedExecutionState *)aligned_alloc(_Alignof(struct AdvancedExecutionState), sizeof(struct AdvancedExecutionState));
+        AdvancedExecutionState_init_v(state, msg, rev, ctx, code, code_size);
+        ++pool->allocations;
+    }
+    return state;
+}
+
+void ExecutionStatePool_release(struct ExecutionStatePool *pool, struct AdvancedExecutionState *state)
+{
+    struct Memory *memory = &state->estate.memory;
+    if (pool->size == EXECUTION_STATE_POOL_SIZE)
+    {
+        ExecutionState_free(&state->estate);
+        free(state);
+        return;
+    }
+    if (memory->m_capacity > EXECUTION_STATE_POOL_MEMORY_LIMIT)
+        Memory_trim(memory, EXECUTION_STATE_POOL_MEMORY_LIMIT);
+    pool->idle[pool->size++] = state;
+}
@@ -4,58 +4,10 @@
 
 #include "instructions_traits.h"
 #include "instructions_xmacro.h"
+#include "byte_order.h"
 #include "sha3.h"
 #include "execution_state.h"
 
-void u256_to_u8_32(struct uint256_t* x, uint8_t* data){
-    uint64_t tmp = LOWER(LOWER_P(x));
-    for(int i = 31; i > 23; i--){
-        data[i] = tmp & 0xFF;
-        tmp = tmp >> 8;
-    }
-    tmp = UPPER(LOWER_P(x));
-    for(int i = 23; i > 15; i--){
-        data[i] = tmp & 0xFF;
-        tmp = tmp >> 8;
-    }
-    tmp = LOWER(UPPER_P(x));
-    for(int i = 15; i > 7; i--){
-        data[i] = tmp & 0xFF;
-        tmp = tmp >> 8;
-    }
-    tmp = UPPER(UPPER_P(x));
-    for(int i = 7; i >= 0; i--){
-        data[i] = tmp & 0xFF;
-        tmp = tmp >> 8;
-    }
-}
-
-void u256_to_u8_20(struct uint256_t* x, uint8_t* data){
-    uint64_t tmp = LOWER(LOWER_P(x));
-    for(int i = 31; i > 23; i--){
-        data[i - 12] = tmp & 0xFF;
-        tmp = tmp >> 8;
-    }
-    tmp = UPPER(LOWER_P(x));
-    for(int i = 23; i > 15; i--){
-        data[i - 12] = tmp & 0xFF;
-        tmp = tmp >> 8;
-    }
-    tmp = LOWER(UPPER_P(x));
-    for(int i = 15; i > 11; i--){
-        data[i - 12] = tmp & 0xFF;
-        tmp = tmp >> 8;
-    }
-}
-
-void u256_to_u8_8(struct uint256_t* x, uint8_t* data){
-    uint64_t tmp = LOWER(LOWER_P(x));
-    for(int i = 31; i > 23; i--){
-        data[i - 24] = tmp & 0xFF;
-        tmp = tmp >> 8;
-    }
-}
-
 typedef uint8_t* code_iterator;
 
 /// Represents the pointer to the stack top item
@@ -285,17 +237,7 @@ void addmod(struct StackTop stack)
     struct uint256_t *x = StackTop_pop(&stack);
     struct uint256_t *y = StackTop_pop(&stack);
     struct uint256_t *m = StackTop_top(&stack);
-    struct uint256_t mod = {0, 0, 0, 0};
-    
-    if(!zero256(m)){
-        struct uint256_t target1 = {0, 0, 0, 0};
-        struct uint256_t target2 = {0, 0, 0, 0};
-        add256(x, y, &target1);
-        divmod256(&target1, m, &target2, &mod);
-        copy256(m, &target2);
-    }
-    else
-        copy256(m, &mod);
+    addmod256(x, y, m, m);
 }
 
 void mulmod(struct StackTop stack)
@@ -303,17 +245,7 @@ void mulmod(struct StackTop stack)
     struct uint256_t *x = StackTop_get(&stack, 0);
     struct uint256_t *y = StackTop_get(&stack, 1);
     struct uint256_t *m = StackTop_get(&stack, 2);
-    struct uint256_t mod = {0, 0, 0, 0};
-
-    if(!zero256(m)){
-        struct uint256_t target1 = {0, 0, 0, 0};
-        struct uint256_t target2 = {0, 0, 0, 0};
-        mul256(x, y, &target1);
-        divmod256(&target1, m, &target2, &mod);
-        copy256(m, &target2);
-    }
-    else
-        copy256(m, &mod);
+    mulmod256(x, y, m, m);
 }
 
 unsigned clz(uint64_t x){
@@ -334,8 +266,8 @@ unsigned count_significant_bytes(uint64_t x){
 }
 
 unsigned csb256(struct uint256_t x){
-    unsigned r64 = count_significant_bytes(64);
-    unsigned tmp = UPPER(UPPER(x));
+    unsigned r64 = sizeof(uint64_t);
+    uint64_t tmp = UPPER(UPPER(x));
     if(tmp != 0){
         return count_significant_bytes(tmp) + r64 * 3;
     }
@@ -347,40 +279,31 @@ unsigned csb256(struct uint256_t x){
     if(tmp != 0){
         return count_significant_bytes(tmp) + r64;
     }
-    tmp = UPPER(LOWER(x));
+    tmp = LOWER(LOWER(x));
         return count_significant_bytes(tmp);
 }
 
+/// The gas EXP charges on top of its base cost, per significant byte of the exponent.
+int exp_additional_cost(enum evmc_revision rev, struct uint256_t *exponent)
+{
+    int exponent_cost = rev >= EVMC_SPURIOUS_DRAGON ? 50 : 10;
+    return (int)csb256(*exponent) * exponent_cost;
+}
+
 enum evmc_status_code exp_(struct StackTop stack, struct ExecutionState* state)
 {
     struct uint256_t *base = StackTop_pop(&stack);
     struct uint256_t *exponent = StackTop_top(&stack);
 
-    int exponent_significant_bytes = csb256(*exponent);
-    int exponent_cost = state->rev >= EVMC_SPURIOUS_DRAGON ? 50 : 10;
-    int additional_cost = exponent_significant_bytes * exponent_cost;
+    int additional_cost = exp_additional_cost(state->rev, exponent);
     if ((state->gas_left -= additional_cost) < 0)
         return EVMC_OUT_OF_GAS;
-    
-    struct uint256_t times = *exponent;
-    struct uint256_t step = {0, 0, 0, 1};
-    struct uint256_t target = *base;
-
-    if(zero256(exponent)){
-        *exponent = step;
-    }
-    else{
-        while (!zero256(exponent))
-        {
-            struct uint256_t tmp = (struct uint256_t){0, 0, 0, 0};
-            mul256(&target, base, &tmp);
-            copy256(&target, &tmp);
 
-            tmp = (struct uint256_t){0, 0, 0, 0};
-            minus256(exponent, &step, &tmp);
-            copy256(exponent, &tmp);
-        }
-    }
+    // The work done by exp256() is bounded by the exponent bit length,
+    // i.e. by the number of bytes already charged above.
+    struct uint256_t target = {0, 0, 0, 0};
+    exp256(base, exponent, &target);
+    copy256(exponent, &target);
     return EVMC_SUCCESS;
 }
 
@@ -626,24 +549,14 @@ enum evmc_status_code keccak256(struct StackTop stack, struct ExecutionState *st
     hash = sha3_Finalize(&c);
     uint8_t *hash_value = (uint8_t*)malloc(32);
     memcpy(hash_value, hash, 32);
-    readu256BE(hash_value, size);
+    load256be(hash_value, size);
     return EVMC_SUCCESS;
 }
 
 void address(struct StackTop stack, struct ExecutionState *state)
 {
-    uint8_t *bytes;
-    memcpy(bytes, state->msg->recipient.bytes, 20);
-    uint8_t addr[32];
-    for (int i = 20; i < 32; i++){
-        addr[i] = 0;
-    }
-    for (int i = 19; i >= 0; i--)
-    {
-        addr[12 + i] = *(bytes + i);
-    }
-    struct uint256_t target = {0, 0, 0, 0};
-    readu256BE(addr, &target);
+    struct uint256_t target;
+    load160be(state->msg->recipient.bytes, &target);
     StackTop_push(&stack, &target);
 }
 
@@ -651,57 +564,37 @@ enum evmc_status_code balance(struct StackTop stack, struct ExecutionState *stat
 {
     struct uint256_t *x = StackTop_top(&stack); 
     evmc_address addr;
-    u256_to_u8_20(x, addr.bytes);
+    store160be(addr.bytes, x);
 
-    if (state->rev >= EVMC_BERLIN && access_account(&state->host_ctx, addr) == EVMC_ACCESS_COLD)
+    if (state->rev >= EVMC_BERLIN && state->host->access_account(state->host_ctx, addr) == EVMC_ACCESS_COLD)
     {
         if ((state->gas_left -= additional_cold_account_access_cost) < 0)
             return EVMC_OUT_OF_GAS;
     }
 
-    evmc_uint256be res = get_balance(&state->host_ctx, addr);
-    readu256BE(res.bytes, x);
+    evmc_uint256be res = state->host->get_balance(state->host_ctx, addr);
+    load256be(res.bytes, x);
     return EVMC_SUCCESS;
 }
 
 void origin(struct StackTop stack, struct ExecutionState *state)
 {
-    evmc_address addr = get_tx_context(&state->host_ctx).tx_origin;
-    uint8_t res[32];
-    for (int i = 20; i < 32; i++){
-        res[i] = 0;
-    }
-    for (int i = 19; i >= 0; i--)
-    {
-        res[12 + i] = *(addr.bytes + i);
-    }
-    struct uint256_t target = {0, 0, 0, 0};
-    readu256BE(res, &target);
+    struct uint256_t target;
+    load160be(ExecutionState_get_tx_context(state)->tx_origin.bytes, &target);
     StackTop_push(&stack, &target);
 }
 
 void caller(struct StackTop stack, struct ExecutionState *state)
 {
-    uint8_t *bytes = (uint8_t*)malloc(20);
-    memcpy(bytes, state->msg->sender.bytes, 20);
-    uint8_t addr[32];
-    memset(addr, 0, 32);
-    for (int i = 19; i >= 0; i--)
-    {
-        addr[12 + i] = *(bytes + i);
-    }
-    struct uint256_t target = {0, 0, 0, 0};
-    readu256BE(addr, &target);
+    struct uint256_t target;
+    load160be(state->msg->sender.bytes, &target);
     StackTop_push(&stack, &target);
 }
 
 void callvalue(struct StackTop stack, struct ExecutionState *state)
 {
-    struct uint256_t target = {0, 0, 0, 0};
-
-    uint8_t tmp[32];
-    memcpy(tmp, state->msg->value.bytes, 32);
-    readu256BE(tmp, &target);
+    struct uint256_t target;
+    load256be(state->msg->value.bytes, &target);
     StackTop_push(&stack, &target);
 }
 
@@ -720,12 +613,15 @@ void calldataload(struct StackTop stack, struct ExecutionState *state)
         size_t begin = LOWER(LOWER_P(index));
         size_t end = MIN(begin + 32, state->msg->input_size);
 
-        uint8_t data[32];
-        for (size_t i = 0; i < (end - begin); ++i)
-            data[i] = state->msg->input_data[begin + i];
-        for (size_t i = (end - begin); i < 32; ++i)
-            data[i] = 0;
-        readu256BE(data, index);
+        if (end - begin == 32)
+            load256be(&state->msg->input_data[begin], index);
+        else
+        {
+            // The word past the end of the calldata is padded with zeros.
+            uint8_t data[32] = {0};
+            memcpy(data, &state->msg->input_data[begin], end - begin);
+            load256be(data, index);
+        }
     }
 }
 
@@ -798,9 +694,9 @@ enum evmc_status_code codecopy(struct StackTop stack, struct ExecutionState *sta
 
 void gasprice(struct StackTop stack, struct ExecutionState *state)
 {
-    evmc_uint256be tx_gp = get_tx_context(&state->host_ctx).tx_gas_price;
+    evmc_uint256be tx_gp = ExecutionState_get_tx_context(state)->tx_gas_price;
     struct uint256_t target = {0, 0, 0, 0};
-    readu256BE(tx_gp.bytes, &target);
+    load256be(tx_gp.bytes, &target);
     StackTop_push(&stack, &target);
 }
 
@@ -808,15 +704,15 @@ enum evmc_status_code extcodesize(struct StackTop stack, struct ExecutionState *
 {
     struct uint256_t *x = StackTop_top(&stack);
     evmc_address addr;
-    u256_to_u8_20(x, addr.bytes);
+    store160be(addr.bytes, x);
 
-    if (state->rev >= EVMC_BERLIN && access_account(&state->host_ctx, addr) == EVMC_ACCESS_COLD)
+    if (state->rev >= EVMC_BERLIN && state->host->access_account(state->host_ctx, addr) == EVMC_ACCESS_COLD)
     {
         if ((state->gas_left -= additional_cold_account_access_cost) < 0)
             return EVMC_OUT_OF_GAS;
     }
 
-    size_t res = get_code_size(&state->host_ctx, addr);
+    size_t res = state->host->get_code_size(state->host_ctx, addr);
     struct uint256_t tmp = {0, 0, 0, (uint64_t)res};
     copy256(x, &tmp);
     return EVMC_SUCCESS;
@@ -826,7 +722,7 @@ enum evmc_status_code extcodecopy(struct StackTop stack, struct ExecutionState *
 {
     struct uint256_t *tmp = StackTop_pop(&stack);
     evmc_address addr;
-    u256_to_u8_20(tmp, addr.bytes);
+    store160be(addr.bytes, tmp);
 
     struct uint256_t *mem_index = StackTop_pop(&stack);
     struct uint256_t *input_index = StackTop_pop(&stack);
@@ -840,7 +736,7 @@ enum evmc_status_code extcodecopy(struct StackTop stack, struct ExecutionState *
     if ((state->gas_left -= copy_cost) < 0)
         return EVMC_OUT_OF_GAS;
 
-    if (state->rev >= EVMC_BERLIN && access_account(&state->host_ctx, addr) == EVMC_ACCESS_COLD)
+    if (state->rev >= EVMC_BERLIN && state->host->access_account(state->host_ctx, addr) == EVMC_ACCESS_COLD)
     {
         if ((state->gas_left -= additional_cold_account_access_cost) < 0)
             return EVMC_OUT_OF_GAS;
@@ -850,7 +746,7 @@ enum evmc_status_code extcodecopy(struct StackTop stack, struct ExecutionState *
     {
         size_t src = MIN((size_t)UINT32_MAX, (size_t)LOWER(LOWER_P(input_index)));
         size_t dst = (size_t)LOWER(LOWER_P(mem_index));
-        size_t num_bytes_copied = copy_code(&state->host_ctx, addr, src, Memory_get(&state->memory, dst), s);
+        size_t num_bytes_copied = state->host->copy_code(state->host_ctx, addr, src, Memory_get(&state->memory, dst), s);
         size_t num_bytes_to_clear = s - num_bytes_copied;
         if (num_bytes_to_clear > 0)
             memset(Memory_get(&state->memory, dst + num_bytes_copied), 0, num_bytes_to_clear);
@@ -896,16 +792,16 @@ enum evmc_status_code extcodehash(struct StackTop stack, struct ExecutionState *
 {
     struct uint256_t *x = StackTop_top(&stack);
     evmc_address addr;
-    u256_to_u8_20(x, addr.bytes);
+    store160be(addr.bytes, x);
 
-    if (state->rev >= EVMC_BERLIN && access_account(&state->host_ctx, addr) == EVMC_ACCESS_COLD)
+    if (state->rev >= EVMC_BERLIN && state->host->access_account(state->host_ctx, addr) == EVMC_ACCESS_COLD)
     {
         if ((state->gas_left -= additional_cold_account_access_cost) < 0)
             return EVMC_OUT_OF_GAS;
     }
 
-    evmc_bytes32 hash = get_code_hash(&state->host_ctx, addr);
-    readu256BE(hash.bytes, x);
+    evmc_bytes32 hash = state->host->get_code_hash(state->host_ctx, addr);
+    load256be(hash.bytes, x);
     return EVMC_SUCCESS;
 }
 
@@ -913,42 +809,33 @@ void blockhash(struct StackTop stack, struct ExecutionState *state)
 {
     struct uint256_t *number = StackTop_top(&stack);
 
-    int64_t upper_bound = get_tx_context(&state->host_ctx).block_number;
+    int64_t upper_bound = ExecutionState_get_tx_context(state)->block_number;
     int64_t lower_bound = (upper_bound - 256) > 0 ? (upper_bound - 256) : 0;
     int64_t n = (int64_t)LOWER(LOWER_P(number));
     evmc_bytes32 tmp;
     memset(tmp.bytes, 0, 32);
-    evmc_bytes32 header = (gt256(number, &(struct uint256_t){0, 0, 0, upper_bound}) && n >= lower_bound) ? get_block_hash(&state->host_ctx, n) : tmp;
-    readu256BE(header.bytes, number);
+    evmc_bytes32 header = (gt256(number, &(struct uint256_t){0, 0, 0, upper_bound}) && n >= lower_bound) ? state->host->get_block_hash(state->host_ctx, n) : tmp;
+    load256be(header.bytes, number);
 }
 
 void coinbase(struct StackTop stack, struct ExecutionState *state)
 {
-    evmc_address addr = get_tx_context(&state->host_ctx).block_coinbase;
-    uint8_t res[32];
-    for (int i = 20; i < 32; i++){
-        res[i] = 0;
-    }
-    for (int i = 19; i >= 0; i--)
-    {
-        res[12 + i] = *(addr.bytes + i);
-    }
-    struct uint256_t target = {0, 0, 0, 0};
-    readu256BE(res, &target);
+    struct uint256_t target;
+    load160be(ExecutionState_get_tx_context(state)->block_coinbase.bytes, &target);
     StackTop_push(&stack, &target);
 
 }
 
 void timestamp(struct StackTop stack, struct ExecutionState *state)
 {
-    int64_t ts = get_tx_context(&state->host_ctx).block_timestamp;
+    int64_t ts = ExecutionState_get_tx_context(state)->block_timestamp;
     struct uint256_t tmp = {0, 0, 0, (uint64_t)ts};
     StackTop_push(&stack, &tmp);
 }
 
 void number(struct StackTop stack, struct ExecutionState *state)
 {
-    int64_t bn = get_tx_context(&state->host_ctx).block_number;
+    int64_t bn = ExecutionState_get_tx_context(state)->block_number;
     struct uint256_t tmp = {0, 0, 0, (uint64_t)bn};
     StackTop_push(&stack, &tmp);
 }
@@ -956,39 +843,39 @@ void number(struct StackTop stack, struct ExecutionState *state)
 // Fix block_difficult
 void difficulty(struct StackTop stack, struct ExecutionState *state)
 {
-    // struct uint256_t bd = get_tx_context(&state->host_ctx).block_difficult;
+    // struct uint256_t bd = ExecutionState_get_tx_context(state)->block_difficult;
     // StackTop_push(&stack, bd);
 }
 
 void gaslimit(struct StackTop stack, struct ExecutionState *state)
 {
-    int64_t bgl = get_tx_context(&state->host_ctx).block_gas_limit;
+    int64_t bgl = ExecutionState_get_tx_context(state)->block_gas_limit;
     struct uint256_t tmp = {0, 0, 0, (uint64_t)bgl};
     StackTop_push(&stack, &tmp);
 }
 
 void chainid(struct StackTop stack, struct ExecutionState *state)
 {
-    evmc_uint256be cid = get_tx_context(&state->host_ctx).chain_id;
+    evmc_uint256be cid = ExecutionState_get_tx_context(state)->chain_id;
     struct uint256_t target = {0, 0, 0, 0};
-    readu256BE(cid.bytes, &target);
+    load256be(cid.bytes, &target);
     StackTop_push(&stack, &target);
 }
 
 void selfbalance(struct StackTop stack, struct ExecutionState *state)
 {
     // TODO: introduce selfbalance in EVMC?
-    evmc_uint256be balance = get_balance(&state->host_ctx, state->msg->recipient);
+    evmc_uint256be balance = state->host->get_balance(state->host_ctx, state->msg->recipient);
     struct uint256_t target = {0, 0, 0, 0};
-    readu256BE(balance.bytes, &target);
+    load256be(balance.bytes, &target);
     StackTop_push(&stack, &target);
 }
 
 void basefee(struct StackTop stack, struct ExecutionState *state)
 {
-    evmc_uint256be bbf = get_tx_context(&state->host_ctx).block_base_fee;
+    evmc_uint256be bbf = ExecutionState_get_tx_context(state)->block_base_fee;
     struct uint256_t target = {0, 0, 0, 0};
-    readu256BE(bbf.bytes, &target);
+    load256be(bbf.bytes, &target);
     StackTop_push(&stack, &target);
 }
 
@@ -1000,7 +887,7 @@ enum evmc_status_code mload(struct StackTop stack, struct ExecutionState *state)
         return EVMC_OUT_OF_GAS;
 
     uint8_t *data = Memory_get(&state->memory, (size_t)LOWER(LOWER_P(index)));
-    readu256BE(data, index);
+    load256be(data, index);
 
     return EVMC_SUCCESS;
 }
@@ -1013,11 +900,7 @@ enum evmc_status_code mstore(struct StackTop stack, struct ExecutionState *state
     if (!check_memory_u64(state, index, 32))
         return EVMC_OUT_OF_GAS;
     
-    uint8_t out[32];
-    memset(out, 0, 32);
-    u256_to_u8_32(value, out);
-    uint8_t *data = Memory_get(&state->memory, (size_t)LOWER(LOWER_P(index)));
-    memcpy(data, out, 32);
+    store256be(Memory_get(&state->memory, (size_t)LOWER(LOWER_P(index))), value);
     return EVMC_SUCCESS;
 }
 
@@ -1029,10 +912,7 @@ enum evmc_status_code mstore8(struct StackTop stack, struct ExecutionState *stat
     if (!check_memory_u64(state, index, 32))
         return EVMC_OUT_OF_GAS;
     
-    uint8_t out[8];
-    u256_to_u8_8(value, out);
-    uint8_t *data = Memory_get(&state->memory, (size_t)LOWER(LOWER_P(index)));
-    memcpy(data, out, 8);
+    store64be(Memory_get(&state->memory, (size_t)LOWER(LOWER_P(index))), WORD_P(value, 0));
     return EVMC_SUCCESS;
 }
 
@@ -1040,11 +920,9 @@ enum evmc_status_code sload(struct StackTop stack, struct ExecutionState *state)
 {
     struct uint256_t *x = StackTop_top(&stack);
     evmc_bytes32 key;
-    memset(key.bytes, 0, 32);
-    if(!zero256(x))
-        u256_to_u8_32(x, key.bytes);
+    store256be(key.bytes, x);
     
-    if (state->rev >= EVMC_BERLIN && access_storage(&state->host_ctx, state->msg->recipient, key) == EVMC_ACCESS_COLD)
+    if (state->rev >= EVMC_BERLIN && state->host->access_storage(state->host_ctx, state->msg->recipient, key) == EVMC_ACCESS_COLD)
     {
         // The warm storage access cost is already applied (from the cost table).
         // Here we need to apply additional cold storage access cost.
@@ -1052,8 +930,8 @@ enum evmc_status_code sload(struct StackTop stack, struct ExecutionState *state)
         if ((state->gas_left -= additional_cold_sload_cost) < 0)
             return EVMC_OUT_OF_GAS;
     }
-    evmc_bytes32 data = get_storage(&state->host_ctx, state->msg->recipient, key);
-    readu256BE(data.bytes, x);
+    evmc_bytes32 data = state->host->get_storage(state->host_ctx, state->msg->recipient, key);
+    load256be(data.bytes, x);
     return EVMC_SUCCESS;
 }
 
@@ -1066,20 +944,16 @@ enum evmc_status_code sstore(struct StackTop stack, struct ExecutionState *state
 
     struct uint256_t *x = StackTop_pop(&stack);
     evmc_bytes32 key;
-    memset(key.bytes, 0, 32);
-    if(!zero256(x))
-        u256_to_u8_32(x, key.bytes);
+    store256be(key.bytes, x);
     x = StackTop_pop(&stack);
     evmc_bytes32 value;
-    memset(value.bytes, 0, 32);
-    if(!zero256(x))
-        u256_to_u8_32(x, value.bytes);
+    store256be(value.bytes, x);
 
     int cost = 0;
-    if (state->rev >= EVMC_BERLIN && access_storage(&state->host_ctx, state->msg->recipient, key) == EVMC_ACCESS_COLD)
+    if (state->rev >= EVMC_BERLIN && state->host->access_storage(state->host_ctx, state->msg->recipient, key) == EVMC_ACCESS_COLD)
         cost = cold_sload_cost;
 
-    enum evmc_status_code status = set_storage(&state->host_ctx, state->msg->recipient, key, value);
+    enum evmc_status_code status = state->host->set_storage(state->host_ctx, state->msg->recipient, key, value);
 
     switch (status)
     {
@@ -1367,7 +1241,7 @@ enum evmc_status_code log0(struct StackTop stack, struct ExecutionState *state)
     cvec_b32 topics;
 
     uint8_t *data = s != 0 ? Memory_get(&state->memory, o) : NULL;
-    emit_log(&state->host_ctx, state->msg->recipient, data, s, topics.data, 0);
+    state->host->emit_log(state->host_ctx, state->msg->recipient, data, s, topics.data, 0);
     return EVMC_SUCCESS;
 }
 
@@ -1391,11 +1265,11 @@ enum evmc_status_code log1(struct StackTop stack, struct ExecutionState *state)
     cvec_b32 topics;
     evmc_bytes32 topic;
     struct uint256_t* tmp = StackTop_pop(&stack);
-    u256_to_u8_32(tmp, topic.bytes);
+    store256be(topic.bytes, tmp);
     cvec_b32_push(&topics, topic);
 
     uint8_t *data = s != 0 ? Memory_get(&state->memory, o) : NULL;
-    emit_log(&state->host_ctx, state->msg->recipient, data, s, topics.data, 1);
+    state->host->emit_log(state->host_ctx, state->msg->recipient, data, s, topics.data, 1);
     return EVMC_SUCCESS;
 }
 
@@ -1423,12 +1297,12 @@ enum evmc_status_code log2_(struct StackTop stack, struct ExecutionState *state)
     for (int i = 0; i < 2; i++)
     {
         tmp = StackTop_pop(&stack);
-        u256_to_u8_32(tmp, topic.bytes);
+        store256be(topic.bytes, tmp);
         cvec_b32_push(&topics, topic);
     }
 
     uint8_t *data = s != 0 ? Memory_get(&state->memory, o) : NULL;
-    emit_log(&state->host_ctx, state->msg->recipient, data, s, topics.data, 2);
+    state->host->emit_log(state->host_ctx, state->msg->recipient, data, s, topics.data, 2);
     return EVMC_SUCCESS;
 }
 
@@ -1456,12 +1330,12 @@ enum evmc_status_code log3(struct StackTop stack, struct ExecutionState *state)
     for (int i = 0; i < 3; i++)
     {
         tmp = StackTop_pop(&stack);
-        u256_to_u8_32(tmp, topic.bytes);
+        store256be(topic.bytes, tmp);
         cvec_b32_push(&topics, topic);
     }
 
     uint8_t *data = s != 0 ? Memory_get(&state->memory, o) : NULL;
-    emit_log(&state->host_ctx, state->msg->recipient, data, s, topics.data, 3);
+    state->host->emit_log(state->host_ctx, state->msg->recipient, data, s, topics.data, 3);
     return EVMC_SUCCESS;
 }
 
@@ -1489,12 +1363,12 @@ enum evmc_status_code log4(struct StackTop stack, struct ExecutionState *state)
     for (int i = 0; i < 4; i++)
     {
         tmp = StackTop_pop(&stack);
-        u256_to_u8_32(tmp, topic.bytes);
+        store256be(topic.bytes, tmp);
         cvec_b32_push(&topics, topic);
     }
 
     uint8_t *data = s != 0 ? Memory_get(&state->memory, o) : NULL;
-    emit_log(&state->host_ctx, state->msg->recipient, data, s, topics.data, 4);
+    state->host->emit_log(state->host_ctx, state->msg->recipient, data, s, topics.data, 4);
     return EVMC_SUCCESS;
 }
 
@@ -1543,9 +1417,9 @@ struct StopToken selfdestruct_(struct StackTop stack, struct ExecutionState* sta
     }
     struct uint256_t* tmp = StackTop_get(&stack, 0);
     evmc_address beneficiary;
-    u256_to_u8_20(tmp, beneficiary.bytes);
+    store160be(beneficiary.bytes, tmp);
 
-    if(state->rev >= EVMC_BERLIN && access_account(&state->host_ctx, beneficiary) == EVMC_ACCESS_COLD){
+    if(state->rev >= EVMC_BERLIN && state->host->access_account(state->host_ctx, beneficiary) == EVMC_ACCESS_COLD){
         if((state->gas_left -= cold_account_access_cost) < 0){
             res.status = EVMC_OUT_OF_GAS;
             return res;
@@ -1554,11 +1428,11 @@ struct StopToken selfdestruct_(struct StackTop stack, struct ExecutionState* sta
 
     if(state->rev >= EVMC_TANGERINE_WHISTLE){
         struct uint256_t balance = {0, 0, 0, 0};
-        readu256BE(get_balance(&state->host_ctx, state->msg->recipient).bytes, &balance);
+        load256be(state->host->get_balance(state->host_ctx, state->msg->recipient).bytes, &balance);
         if(state->rev == EVMC_TANGERINE_WHISTLE || LOWER(LOWER(balance))){
             // After TANGERINE_WHISTLE apply additional cost of
             // sending value to a non-existing account.
-            if(!account_exists(&state->host_ctx, beneficiary)){
+            if(!state->host->account_exists(state->host_ctx, beneficiary)){
                 if((state->gas_left -= 25000) < 0){
                     res.status = EVMC_OUT_OF_GAS;
                 }
@@ -1566,7 +1440,7 @@ struct StopToken selfdestruct_(struct StackTop stack, struct ExecutionState* sta
         }
     }
 
-    selfdestruct(&state->host_ctx, state->msg->recipient, beneficiary);
+    state->host->selfdestruct(state->host_ctx, state->msg->recipient, beneficiary);
     res.status = EVMC_SUCCESS;
     return res;
 }
@@ -1576,7 +1450,7 @@ enum evmc_status_code call_(struct StackTop stack, struct ExecutionState* state)
     struct uint256_t* tmp = StackTop_pop(&stack);
     evmc_address dst;
     memset(dst.bytes, 0, 20);
-    u256_to_u8_20(tmp, dst.bytes);
+    store160be(dst.bytes, tmp);
 
     struct uint256_t* value = StackTop_pop(&stack);
     bool has_value = zero256(value);
@@ -1588,7 +1462,7 @@ enum evmc_status_code call_(struct StackTop stack, struct ExecutionState* state)
     // Assume failure
     StackTop_push(&stack, &(struct uint256_t){0, 0, 0, 0});
 
-    if(state->rev >= EVMC_BERLIN && access_account(&state->host_ctx, dst) == EVMC_ACCESS_COLD){
+    if(state->rev >= EVMC_BERLIN && state->host->access_account(state->host_ctx, dst) == EVMC_ACCESS_COLD){
         if((state->gas_left -= additional_cold_account_access_cost) < 0){
             return EVMC_OUT_OF_GAS;
         }
@@ -1609,7 +1483,7 @@ enum evmc_status_code call_(struct StackTop stack, struct ExecutionState* state)
     msg.sender = state->msg->recipient;
     evmc_uint256be value_;
     memset(value_.bytes, 0, 32);
-    u256_to_u8_32(value, value_.bytes);
+    store256be(value_.bytes, value);
     msg.value = value_;
 
     size_t input_size_ = (size_t)LOWER(LOWER_P(input_size));
@@ -1623,7 +1497,7 @@ enum evmc_status_code call_(struct StackTop stack, struct ExecutionState* state)
     if(has_value && ExecutionState_in_static_mode(state))
         return EVMC_STATIC_MODE_VIOLATION;
 
-    if((has_value || state->rev < EVMC_SPURIOUS_DRAGON) && !account_exists(&state->host_ctx, dst))
+    if((has_value || state->rev < EVMC_SPURIOUS_DRAGON) && !state->host->account_exists(state->host_ctx, dst))
         cost += 25000;
 
     if((state->gas_left -= cost) < 0)
@@ -1650,13 +1524,13 @@ enum evmc_status_code call_(struct StackTop stack, struct ExecutionState* state)
     if(state->msg->depth >= 1024)
         return EVMC_SUCCESS;
 
-    evmc_uint256be b = get_balance(&state->host_ctx, state->msg->recipient);
+    evmc_uint256be b = state->host->get_balance(state->host_ctx, state->msg->recipient);
     struct uint256_t target = {0, 0, 0, 0};
-    readu256BE(b.bytes, &target);
+    load256be(b.bytes, &target);
     if(has_value && gt256(value, &target))
         return EVMC_SUCCESS;
 
-    struct evmc_result result = call(&state->host_ctx, msg);
+    struct evmc_result result = state->host->call(state->host_ctx, msg);
     for(int i = 0; i < result.output_size; i++){
         *(state->return_data + i) = *(result.output_data + i);
     }
@@ -1676,7 +1550,7 @@ enum evmc_status_code staticcall(struct StackTop stack, struct ExecutionState* s
     struct uint256_t* tmp = StackTop_pop(&stack);
     evmc_address dst;
     memset(dst.bytes, 0, 20);
-    u256_to_u8_20(tmp, dst.bytes);
+    store160be(dst.bytes, tmp);
 
     struct uint256_t* value = &(struct uint256_t){0, 0, 0, 0};
     bool has_value = zero256(value);
@@ -1688,7 +1562,7 @@ enum evmc_status_code staticcall(struct StackTop stack, struct ExecutionState* s
     // Assume failure
     StackTop_push(&stack, &(struct uint256_t){0, 0, 0, 0});
 
-    if(state->rev >= EVMC_BERLIN && access_account(&state->host_ctx, dst) == EVMC_ACCESS_COLD){
+    if(state->rev >= EVMC_BERLIN && state->host->access_account(state->host_ctx, dst) == EVMC_ACCESS_COLD){
         if((state->gas_left -= additional_cold_account_access_cost) < 0){
             return EVMC_OUT_OF_GAS;
         }
@@ -1709,7 +1583,7 @@ enum evmc_status_code staticcall(struct StackTop stack, struct ExecutionState* s
     msg.sender = state->msg->recipient;
     evmc_uint256be value_;
     memset(value_.bytes, 0, 32);
-    u256_to_u8_32(value, value_.bytes);
+    store256be(value_.bytes, value);
     msg.value = value_;
 
     size_t input_size_ = (size_t)LOWER(LOWER_P(input_size));
@@ -1744,13 +1618,13 @@ enum evmc_status_code staticcall(struct StackTop stack, struct ExecutionState* s
     if(state->msg->depth >= 1024)
         return EVMC_SUCCESS;
 
-    evmc_uint256be b = get_balance(&state->host_ctx, state->msg->recipient);
+    evmc_uint256be b = state->host->get_balance(state->host_ctx, state->msg->recipient);
     struct uint256_t target = {0, 0, 0, 0};
-    readu256BE(b.bytes, &target);
+    load256be(b.bytes, &target);
     if(has_value && gt256(value, &target))
         return EVMC_SUCCESS;
 
-    struct evmc_result result = call(&state->host_ctx, msg);
+    struct evmc_result result = state->host->call(state->host_ctx, msg);
     for(int i = 0; i < result.output_size; i++){
         *(state->return_data + i) = *(result.output_data + i);
     }
@@ -1770,7 +1644,7 @@ enum evmc_status_code delegatecall(struct StackTop stack, struct ExecutionState*
     struct uint256_t* tmp = StackTop_pop(&stack);
     evmc_address dst;
     memset(dst.bytes, 0, 20);
-    u256_to_u8_20(tmp, dst.bytes);
+    store160be(dst.bytes, tmp);
 
     struct uint256_t* value = &(struct uint256_t){0, 0, 0, 0};
     bool has_value = zero256(value);
@@ -1782,7 +1656,7 @@ enum evmc_status_code delegatecall(struct StackTop stack, struct ExecutionState*
     // Assume failure
     StackTop_push(&stack, &(struct uint256_t){0, 0, 0, 0});
 
-    if(state->rev >= EVMC_BERLIN && access_account(&state->host_ctx, dst) == EVMC_ACCESS_COLD){
+    if(state->rev >= EVMC_BERLIN && state->host->access_account(state->host_ctx, dst) == EVMC_ACCESS_COLD){
         if((state->gas_left -= additional_cold_account_access_cost) < 0){
             return EVMC_OUT_OF_GAS;
         }
@@ -1835,13 +1709,13 @@ enum evmc_status_code delegatecall(struct StackTop stack, struct ExecutionState*
     if(state->msg->depth >= 1024)
         return EVMC_SUCCESS;
 
-    evmc_uint256be b = get_balance(&state->host_ctx, state->msg->recipient);
+    evmc_uint256be b = state->host->get_balance(state->host_ctx, state->msg->recipient);
     struct uint256_t target = {0, 0, 0, 0};
-    readu256BE(b.bytes, &target);
+    load256be(b.bytes, &target);
     if(has_value && gt256(value, &target))
         return EVMC_SUCCESS;
 
-    struct evmc_result result = call(&state->host_ctx, msg);
+    struct evmc_result result = state->host->call(state->host_ctx, msg);
     for(int i = 0; i < result.output_size; i++){
         *(state->return_data + i) = *(result.output_data + i);
     }
@@ -1861,7 +1735,7 @@ enum evmc_status_code callcode(struct StackTop stack, struct ExecutionState* sta
     struct uint256_t* tmp = StackTop_pop(&stack);
     evmc_address dst;
     memset(dst.bytes, 0, 20);
-    u256_to_u8_20(tmp, dst.bytes);
+    store160be(dst.bytes, tmp);
 
     struct uint256_t* value = StackTop_pop(&stack);
     bool has_value = zero256(value);
@@ -1873,7 +1747,7 @@ enum evmc_status_code callcode(struct StackTop stack, struct ExecutionState* sta
     // Assume failure
     StackTop_push(&stack, &(struct uint256_t){0, 0, 0, 0});
 
-    if(state->rev >= EVMC_BERLIN && access_account(&state->host_ctx, dst) == EVMC_ACCESS_COLD){
+    if(state->rev >= EVMC_BERLIN && state->host->access_account(state->host_ctx, dst) == EVMC_ACCESS_COLD){
         if((state->gas_left -= additional_cold_account_access_cost) < 0){
             return EVMC_OUT_OF_GAS;
         }
@@ -1894,7 +1768,7 @@ enum evmc_status_code callcode(struct StackTop stack, struct ExecutionState* sta
     msg.sender = state->msg->recipient;
     evmc_uint256be value_;
     memset(value_.bytes, 0, 32);
-    u256_to_u8_32(value, value_.bytes);
+    store256be(value_.bytes, value);
     msg.value = value_;
 
     size_t input_size_ = (size_t)LOWER(LOWER_P(input_size));
@@ -1929,13 +1803,13 @@ enum evmc_status_code callcode(struct StackTop stack, struct ExecutionState* sta
     if(state->msg->depth >= 1024)
         return EVMC_SUCCESS;
 
-    evmc_uint256be b = get_balance(&state->host_ctx, state->msg->recipient);
+    evmc_uint256be b = state->host->get_balance(state->host_ctx, state->msg->recipient);
     struct uint256_t target = {0, 0, 0, 0};
-    readu256BE(b.bytes, &target);
+    load256be(b.bytes, &target);
     if(has_value && gt256(value, &target))
         return EVMC_SUCCESS;
 
-    struct evmc_result result = call(&state->host_ctx, msg);
+    struct evmc_result result = state->host->call(state->host_ctx, msg);
     for(int i = 0; i < result.output_size; i++){
         *(state->return_data + i) = *(result.output_data + i);
     }
@@ -1969,9 +1843,9 @@ enum evmc_status_code create(struct StackTop stack, struct ExecutionState* state
     if(state->msg->depth >= 1024)
         return EVMC_SUCCESS;
     
-    evmc_uint256be b = get_balance(&state->host_ctx, state->msg->recipient);
+    evmc_uint256be b = state->host->get_balance(state->host_ctx, state->msg->recipient);
     struct uint256_t tmp = (struct uint256_t){0, 0, 0, 0};
-    readu256BE(b.bytes, &tmp);
+    load256be(b.bytes, &tmp);
     if(!zero256(endowment) && gt256(endowment, &tmp))
         return EVMC_SUCCESS;
     
@@ -1987,24 +1861,16 @@ enum evmc_status_code create(struct StackTop stack, struct ExecutionState* state
     }
     msg.sender = state->msg->recipient;
     msg.depth = state->msg->depth + 1;
-    u256_to_u8_32(&salt, msg.create2_salt.bytes);
-    u256_to_u8_32(endowment, msg.value.bytes);
+    store256be(msg.create2_salt.bytes, &salt);
+    store256be(msg.value.bytes, endowment);
     
-    struct evmc_result result = call(&state->host_ctx, msg);
+    struct evmc_result result = state->host->call(state->host_ctx, msg);
     state->gas_left -= msg.gas - result.gas_left;
 
     memcpy(state->return_data, result.output_data, result.output_size);
     if(result.status_code == EVMC_SUCCESS){
-        evmc_address addr = result.create_address;
-        uint8_t tmp[32];
-        for (int i = 20; i < 32; i++){
-            tmp[i] = 0;
-        }
-        for (int i = 19; i >= 0; i--){
-            tmp[12 + i] = *(addr.bytes + i);
-        }
-        struct uint256_t target = {0, 0, 0, 0};
-        readu256BE(tmp, &target);
+        struct uint256_t target;
+        load160be(result.create_address.bytes, &target);
         StackTop_push(&stack, &target);
     }
     
@@ -2033,9 +1899,9 @@ enum evmc_status_code create2(struct StackTop stack, struct ExecutionState* stat
     if(state->msg->depth >= 1024)
         return EVMC_SUCCESS;
     
-    evmc_uint256be b = get_balance(&state->host_ctx, state->msg->recipient);
+    evmc_uint256be b = state->host->get_balance(state->host_ctx, state->msg->recipient);
     struct uint256_t tmp = (struct uint256_t){0, 0, 0, 0};
-    readu256BE(b.bytes, &tmp);
+    load256be(b.bytes, &tmp);
     if(!zero256(endowment) && gt256(endowment, &tmp))
         return EVMC_SUCCESS;
     
@@ -2051,24 +1917,16 @@ enum evmc_status_code create2(struct StackTop stack, struct ExecutionState* stat
     }
     msg.sender = state->msg->recipient;
     msg.depth = state->msg->depth + 1;
-    u256_to_u8_32(&salt, msg.create2_salt.bytes);
-    u256_to_u8_32(endowment, msg.value.bytes);
+    store256be(msg.create2_salt.bytes, &salt);
+    store256be(msg.value.bytes, endowment);
     
-    struct evmc_result result = call(&state->host_ctx, msg);
+    struct evmc_result result = state->host->call(state->host_ctx, msg);
     state->gas_left -= msg.gas - result.gas_left;
 
     memcpy(state->return_data, result.output_data, result.output_size);
     if(result.status_code == EVMC_SUCCESS){
-        evmc_address addr = result.create_address;
-        uint8_t tmp[32];
-        for (int i = 20; i < 32; i++){
-            tmp[i] = 0;
-        }
-        for (int i = 19; i >= 0; i--){
-            tmp[12 + i] = *(addr.bytes + i);
-        }
-        struct uint256_t target = {0, 0, 0, 0};
-        readu256BE(tmp, &target);
+        struct uint256_t target;
+        load160be(result.create_address.bytes, &target);
         StackTop_push(&stack, &target);
     }
     
@@ -431,7 +431,7 @@ struct Instruction* op_jump(struct Instruction* instr, struct AdvancedExecutionS
     if( dst_ > INT_MAX || (pc = find_jumpdest(state->analysis.advanced, dst_)) < 0)
         return AdvancedExecutionState_exit(astate, EVMC_BAD_JUMP_DESTINATION);
     
-    return cvec_instr_at_mut(&state->analysis.advanced->instrs, pc);
+    return &state->analysis.advanced->instrs[pc];
 }
 
 struct Instruction* op_jumpi(struct Instruction* instr, struct AdvancedExecutionState* astate){
@@ -0,0 +1,810 @@
+#pragma once
+
+#include <stddef.h>
+#include <sys/mman.h>
+
+#include "execution.h"
+
+/// The template JIT: turns the Instruction table of analyze() into native code, one stencil
+/// per instruction. The stack and block instructions and the simple arithmetic are inlined,
+/// every other instruction is a call of its instruction_exec_fn, which keeps the host calls
+/// and the complex arithmetic in C. The native code keeps the state in astate exactly as the
+/// interpreter does, so inlined and called instructions mix freely.
+///
+/// x86-64 and AArch64 are generated, the stencils of each in a section of their own with the
+/// same inlined instructions. On other targets jit_compile() fails and execute_jit() runs the
+/// advanced interpreter instead.
+
+#define JIT_ARCH_NONE 0
+#define JIT_ARCH_X86_64 1
+#define JIT_ARCH_AARCH64 2
+
+#ifndef JIT_ARCH
+#if defined(__x86_64__) && defined(__linux__)
+#define JIT_ARCH JIT_ARCH_X86_64
+#elif defined(__aarch64__) && defined(__linux__)
+#define JIT_ARCH JIT_ARCH_AARCH64
+#else
+#define JIT_ARCH JIT_ARCH_NONE
+#endif
+#endif
+
+#define JIT_AVAILABLE (JIT_ARCH != JIT_ARCH_NONE)
+
+/// The most native code bytes an instruction is compiled to.
+#define JIT_MAX_STENCIL_SIZE 96
+
+typedef void (*jit_fn)(struct AdvancedExecutionState *astate);
+
+/// The native code of an analysis.
+struct JitCode
+{
+    /// The mapping: the code followed by the native address of every instruction.
+    uint8_t *code;
+    size_t size;
+
+    jit_fn entry;
+};
+
+/// The emitter of the native code.
+struct JitBuffer
+{
+    uint8_t *pos;
+};
+
+void jit_byte(struct JitBuffer *buffer, uint8_t byte)
+{
+    *buffer->pos++ = byte;
+}
+
+void jit_bytes(struct JitBuffer *buffer, const uint8_t *bytes, size_t size)
+{
+    memcpy(buffer->pos, bytes, size);
+    buffer->pos += size;
+}
+
+void jit_u32(struct JitBuffer *buffer, uint32_t value)
+{
+    memcpy(buffer->pos, &value, 4);
+    buffer->pos += 4;
+}
+
+void jit_u64(struct JitBuffer *buffer, uint64_t value)
+{
+    memcpy(buffer->pos, &value, 8);
+    buffer->pos += 8;
+}
+
+// The x86-64 stencils, rbx holding astate and rax the top item or the next instruction.
+
+/// Emits a jump with a 32-bit displacement (E9 or 0F 8x) to the target.
+void jit_jump(struct JitBuffer *buffer, uint8_t condition, const uint8_t *target)
+{
+    if (condition != 0)
+    {
+        jit_byte(buffer, 0x0f);
+        jit_byte(buffer, condition);
+    }
+    else
+        jit_byte(buffer, 0xe9);
+    jit_u32(buffer, (uint32_t)(int32_t)(target - (buffer->pos + 4)));
+}
+
+#define JIT_JE 0x84
+#define JIT_JNE 0x85
+#define JIT_JS 0x88
+#define JIT_JL 0x8c
+#define JIT_JG 0x8f
+
+/// An instruction of the form REX.W op [rbx + field] with the register in reg, rbx being astate.
+void jit_astate(struct JitBuffer *buffer, uint8_t op, uint8_t reg, size_t field)
+{
+    jit_byte(buffer, 0x48);
+    jit_byte(buffer, op);
+    jit_byte(buffer, (uint8_t)(0x83 | reg << 3));
+    jit_u32(buffer, (uint32_t)field);
+}
+
+/// An instruction of the form REX.W op [rax + displacement] with the register in reg.
+void jit_item(struct JitBuffer *buffer, uint8_t op, uint8_t reg, int8_t displacement)
+{
+    jit_byte(buffer, 0x48);
+    jit_byte(buffer, op);
+    jit_byte(buffer, (uint8_t)(0x40 | reg << 3));
+    jit_byte(buffer, (uint8_t)displacement);
+}
+
+/// MOVDQU between xmm and [rax + displacement], op 6F loading and 7F storing.
+void jit_movdqu(struct JitBuffer *buffer, uint8_t op, uint8_t xmm, int32_t displacement)
+{
+    uint8_t bytes[] = {0xf3, 0x0f, op, (uint8_t)(0x80 | xmm << 3)};
+    jit_bytes(buffer, bytes, sizeof(bytes));
+    jit_u32(buffer, (uint32_t)displacement);
+}
+
+#define JIT_RAX 0
+#define JIT_RCX 1
+#define JIT_RDX 2
+
+#define JIT_TOP offsetof(struct AdvancedExecutionState, stack.top_item)
+#define JIT_BOTTOM offsetof(struct AdvancedExecutionState, stack.m_bottom)
+#define JIT_GAS_LEFT offsetof(struct AdvancedExecutionState, estate.gas_left)
+#define JIT_BLOCK_COST offsetof(struct AdvancedExecutionState, current_block_cost)
+
+/// The word operations of ADD, SUB, AND, OR and XOR, from the least significant word: the
+/// operation of the first word and of the following ones, the carry chained for ADD and SUB.
+struct JitWordOp
+{
+    uint8_t first;
+    uint8_t next;
+};
+
+/// x = top word op second word, stored to the second item, and pops the top.
+void jit_word_op(struct JitBuffer *buffer, struct JitWordOp op, bool into_second)
+{
+    jit_astate(buffer, 0x8b, JIT_RAX, JIT_TOP);
+    for (int word = 3; word >= 0; --word)
+    {
+        uint8_t code = word == 3 ? op.first : op.next;
+        jit_item(buffer, 0x8b, JIT_RCX, (int8_t)(8 * word));
+        if (into_second)
+            // op [rax + second], rcx
+            jit_item(buffer, code, JIT_RCX, (int8_t)(8 * word - 32));
+        else
+        {
+            // op rcx, [rax + second]; mov [rax + second], rcx
+            jit_item(buffer, code, JIT_RCX, (int8_t)(8 * word - 32));
+            jit_item(buffer, 0x89, JIT_RCX, (int8_t)(8 * word - 32));
+        }
+    }
+    // sub qword [rbx + top], 32
+    uint8_t pop[] = {0x48, 0x83, 0xab};
+    jit_bytes(buffer, pop, sizeof(pop));
+    jit_u32(buffer, (uint32_t)JIT_TOP);
+    jit_byte(buffer, 32);
+}
+
+/// Emits the inlined stencil of the instruction, returns false if it has none.
+bool jit_inline(struct JitBuffer *buffer, const struct Instruction *instr, const uint8_t *exit)
+{
+    instruction_exec_fn fn = instr->fn;
+
+    if (fn == opx_beginblock)
+    {
+        struct BlockInfo block = instr->arg.block;
+        // mov eax, gas_cost; sub [rbx + gas_left], rax; js exit
+        jit_byte(buffer, 0xb8);
+        jit_u32(buffer, block.gas_cost);
+        jit_astate(buffer, 0x29, JIT_RAX, JIT_GAS_LEFT);
+        jit_jump(buffer, JIT_JS, exit);
+        // The stack size: (top - bottom) / 32.
+        jit_astate(buffer, 0x8b, JIT_RAX, JIT_TOP);
+        jit_astate(buffer, 0x2b, JIT_RAX, JIT_BOTTOM);
+        uint8_t sar[] = {0x48, 0xc1, 0xf8, 5};
+        jit_bytes(buffer, sar, sizeof(sar));
+        // cmp rax, stack_req; jl exit
+        jit_byte(buffer, 0x48);
+        jit_byte(buffer, 0x3d);
+        jit_u32(buffer, (uint32_t)(int32_t)block.stack_req);
+        jit_jump(buffer, JIT_JL, exit);
+        // add rax, stack_max_growth; cmp rax, 1024; jg exit
+        jit_byte(buffer, 0x48);
+        jit_byte(buffer, 0x05);
+        jit_u32(buffer, (uint32_t)(int32_t)block.stack_max_growth);
+        jit_byte(buffer, 0x48);
+        jit_byte(buffer, 0x3d);
+        jit_u32(buffer, 1024);
+        jit_jump(buffer, JIT_JG, exit);
+        // mov dword [rbx + current_block_cost], gas_cost
+        jit_byte(buffer, 0xc7);
+        jit_byte(buffer, 0x83);
+        jit_u32(buffer, (uint32_t)JIT_BLOCK_COST);
+        jit_u32(buffer, block.gas_cost);
+        return true;
+    }
+
+    bool push_small = fn == op_push_small;
+    bool push_full = fn == op_push_full;
+    int dup = 0;
+    int swap = 0;
+    static const instruction_exec_fn dups[] = {op_dup1, op_dup2, op_dup3, op_dup4, op_dup5, op_dup6, op_dup7, op_dup8,
+                                               op_dup9, op_dup10, op_dup11, op_dup12, op_dup13, op_dup14, op_dup15, op_dup16};
+    static const instruction_exec_fn swaps[] = {op_swap1, op_swap2, op_swap3, op_swap4, op_swap5, op_swap6, op_swap7, op_swap8,
+                                                op_swap9, op_swap10, op_swap11, op_swap12, op_swap13, op_swap14, op_swap15, op_swap16};
+    for (int n = 0; n < 16; ++n)
+    {
+        if (fn == dups[n])
+            dup = n + 1;
+        if (fn == swaps[n])
+            swap = n + 1;
+    }
+
+    if (push_small || push_full || dup != 0)
+    {
+        // mov rax, [rbx + top]
+        jit_astate(buffer, 0x8b, JIT_RAX, JIT_TOP);
+        if (push_small)
+        {
+            // xor ecx, ecx; the three high words zero; mov rcx, value; the low word
+            uint8_t zero[] = {0x31, 0xc9};
+            jit_bytes(buffer, zero, sizeof(zero));
+            for (int word = 0; word < 3; ++word)
+                jit_item(buffer, 0x89, JIT_RCX, (int8_t)(32 + 8 * word));
+            jit_byte(buffer, 0x48);
+            jit_byte(buffer, 0xb9);
+            jit_u64(buffer, instr->arg.small_push_value);
+            jit_item(buffer, 0x89, JIT_RCX, 32 + 24);
+        }
+        else
+        {
+            if (push_full)
+            {
+                // mov rcx, push_value; movdqu xmm0, [rcx]; movdqu xmm1, [rcx + 16]
+                jit_byte(buffer, 0x48);
+                jit_byte(buffer, 0xb9);
+                jit_u64(buffer, (uint64_t)(uintptr_t)instr->arg.push_value);
+                uint8_t load[] = {0xf3, 0x0f, 0x6f, 0x01, 0xf3, 0x0f, 0x6f, 0x49, 0x10};
+                jit_bytes(buffer, load, sizeof(load));
+            }
+            else
+            {
+                jit_movdqu(buffer, 0x6f, 0, -32 * (dup - 1));
+                jit_movdqu(buffer, 0x6f, 1, -32 * (dup - 1) + 16);
+            }
+            jit_movdqu(buffer, 0x7f, 0, 32);
+            jit_movdqu(buffer, 0x7f, 1, 48);
+        }
+        // add qword [rbx + top], 32
+        uint8_t push[] = {0x48, 0x83, 0x83};
+        jit_bytes(buffer, push, sizeof(push));
+        jit_u32(buffer, (uint32_t)JIT_TOP);
+        jit_byte(buffer, 32);
+        return true;
+    }
+
+    if (swap != 0)
+    {
+        jit_astate(buffer, 0x8b, JIT_RAX, JIT_TOP);
+        jit_movdqu(buffer, 0x6f, 0, 0);
+        jit_movdqu(buffer, 0x6f, 1, 16);
+        jit_movdqu(buffer, 0x6f, 2, -32 * swap);
+        jit_movdqu(buffer, 0x6f, 3, -32 * swap + 16);
+        jit_movdqu(buffer, 0x7f, 2, 0);
+        jit_movdqu(buffer, 0x7f, 3, 16);
+        jit_movdqu(buffer, 0x7f, 0, -32 * swap);
+        jit_movdqu(buffer, 0x7f, 1, -32 * swap + 16);
+        return true;
+    }
+
+    if (fn == op_pop)
+    {
+        // sub qword [rbx + top], 32
+        uint8_t pop[] = {0x48, 0x83, 0xab};
+        jit_bytes(buffer, pop, sizeof(pop));
+        jit_u32(buffer, (uint32_t)JIT_TOP);
+        jit_byte(buffer, 32);
+        return true;
+    }
+
+    // ADD and the bitwise operations are commutative: op [second], rcx. SUB is top - second.
+    if (fn == op_add)
+        jit_word_op(buffer, (struct JitWordOp){0x01, 0x11}, true);
+    else if (fn == op_sub)
+        jit_word_op(buffer, (struct JitWordOp){0x2b, 0x1b}, false);
+    else if (fn == op_and)
+        jit_word_op(buffer, (struct JitWordOp){0x21, 0x21}, true);
+    else if (fn == op_or)
+        jit_word_op(buffer, (struct JitWordOp){0x09, 0x09}, true);
+    else if (fn == op_xor)
+        jit_word_op(buffer, (struct JitWordOp){0x31, 0x31}, true);
+    else if (fn == op_iszero)
+    {
+        // rcx = the words or'ed; edx = rcx == 0; the top = edx
+        jit_astate(buffer, 0x8b, JIT_RAX, JIT_TOP);
+        jit_item(buffer, 0x8b, JIT_RCX, 0);
+        for (int word = 1; word < 4; ++word)
+            jit_item(buffer, 0x0b, JIT_RCX, (int8_t)(8 * word));
+        uint8_t test[] = {0x31, 0xd2, 0x48, 0x85, 0xc9, 0x0f, 0x94, 0xc2};
+        jit_bytes(buffer, test, sizeof(test));
+        jit_item(buffer, 0x89, JIT_RDX, 24);
+        uint8_t zero[] = {0x31, 0xd2};
+        jit_bytes(buffer, zero, sizeof(zero));
+        for (int word = 0; word < 3; ++word)
+            jit_item(buffer, 0x89, JIT_RDX, (int8_t)(8 * word));
+    }
+    else
+        return false;
+    return true;
+}
+
+/// Emits the call of the instruction_exec_fn: exit on NULL, continue with the next stencil on
+/// the next instruction and dispatch any other one.
+void jit_call(struct JitBuffer *buffer, const struct Instruction *instr, const uint8_t *exit, const uint8_t *dispatch)
+{
+    // mov rdi, instr; mov rsi, rbx; mov rax, fn; call rax
+    jit_byte(buffer, 0x48);
+    jit_byte(buffer, 0xbf);
+    jit_u64(buffer, (uint64_t)(uintptr_t)instr);
+    uint8_t astate[] = {0x48, 0x89, 0xde};
+    jit_bytes(buffer, astate, sizeof(astate));
+    jit_byte(buffer, 0x48);
+    jit_byte(buffer, 0xb8);
+    jit_u64(buffer, (uint64_t)(uintptr_t)instr->fn);
+    uint8_t call[] = {0xff, 0xd0, 0x48, 0x85, 0xc0};
+    jit_bytes(buffer, call, sizeof(call));
+    jit_jump(buffer, JIT_JE, exit);
+    // mov rcx, instr + 1; cmp rax, rcx; jne dispatch
+    jit_byte(buffer, 0x48);
+    jit_byte(buffer, 0xb9);
+    jit_u64(buffer, (uint64_t)(uintptr_t)(instr + 1));
+    uint8_t cmp[] = {0x48, 0x39, 0xc8};
+    jit_bytes(buffer, cmp, sizeof(cmp));
+    jit_jump(buffer, JIT_JNE, dispatch);
+}
+
+/// Emits the entry of the native code, which jumps over the exit and the dispatch emitted
+/// after it to the code following them.
+void jit_entry(struct JitBuffer *b, const struct Instruction *instrs, uint8_t **addresses, uint8_t **exit, uint8_t **dispatch)
+{
+    // push rbp; mov rbp, rsp; push rbx; push r12; mov rbx, rdi; jmp over the stubs
+    uint8_t prologue[] = {0x55, 0x48, 0x89, 0xe5, 0x53, 0x41, 0x54, 0x48, 0x89, 0xfb};
+    jit_bytes(b, prologue, sizeof(prologue));
+    uint8_t *start = b->pos;
+    b->pos += 5;
+
+    // exit: pop r12; pop rbx; pop rbp; ret
+    *exit = b->pos;
+    uint8_t epilogue[] = {0x41, 0x5c, 0x5b, 0x5d, 0xc3};
+    jit_bytes(b, epilogue, sizeof(epilogue));
+
+    // dispatch: jmp [addresses + (rax - instrs) / sizeof(struct Instruction) * 8]
+    *dispatch = b->pos;
+    jit_byte(b, 0x48);
+    jit_byte(b, 0xb9);
+    jit_u64(b, (uint64_t)(uintptr_t)instrs);
+    uint8_t index[] = {0x48, 0x29, 0xc8, 0x48, 0xc1, 0xe8, (uint8_t)__builtin_ctzl(sizeof(struct Instruction))};
+    jit_bytes(b, index, sizeof(index));
+    jit_byte(b, 0x48);
+    jit_byte(b, 0xb9);
+    jit_u64(b, (uint64_t)(uintptr_t)addresses);
+    uint8_t jump[] = {0xff, 0x24, 0xc1};
+    jit_bytes(b, jump, sizeof(jump));
+
+    struct JitBuffer entry = {start};
+    jit_jump(&entry, 0, b->pos);
+}
+
+// The AArch64 stencils, x19 holding astate and x0 the top item or the next instruction.
+// The items are moved with LDP/STP of q registers, the words with LDP/STP of x registers.
+
+/// The condition codes of B.cond, the inverse condition being the code ^ 1.
+#define JIT_A64_NE 0x1
+#define JIT_A64_MI 0x4
+#define JIT_A64_LT 0xb
+#define JIT_A64_GT 0xc
+
+/// The load and store pair opcodes, with the scale of their offset.
+#define JIT_A64_LDP_X 0xa9400000
+#define JIT_A64_STP_X 0xa9000000
+#define JIT_A64_LDP_Q 0xad400000
+#define JIT_A64_STP_Q 0xad000000
+
+#define JIT_A64_XZR 31
+
+void jit_a64(struct JitBuffer *buffer, uint32_t instr)
+{
+    jit_u32(buffer, instr);
+}
+
+/// MOVZ and MOVK of the value into the x register, the zero halfwords above the first skipped.
+void jit_a64_mov(struct JitBuffer *buffer, uint32_t reg, uint64_t value)
+{
+    jit_a64(buffer, 0xd2800000 | (uint32_t)(value & 0xffff) << 5 | reg);
+    for (uint32_t hw = 1; hw < 4; ++hw)
+    {
+        uint32_t half = (uint32_t)(value >> (16 * hw)) & 0xffff;
+        if (half != 0)
+            jit_a64(buffer, 0xf2800000 | hw << 21 | half << 5 | reg);
+    }
+}
+
+/// MOVZ and MOVK of the value into the w register.
+void jit_a64_mov32(struct JitBuffer *buffer, uint32_t reg, uint32_t value)
+{
+    jit_a64(buffer, 0x52800000 | (value & 0xffff) << 5 | reg);
+    if ((value >> 16) != 0)
+        jit_a64(buffer, 0x72a00000 | (value >> 16) << 5 | reg);
+}
+
+/// LDR (0xf9400000) or STR (0xf9000000) of the x register at [x19 + field].
+void jit_a64_astate(struct JitBuffer *buffer, uint32_t op, uint32_t reg, size_t field)
+{
+    jit_a64(buffer, op | (uint32_t)(field / 8) << 10 | 19 << 5 | reg);
+}
+
+/// A load or store pair of the registers at [base + offset], offset a multiple of the scale.
+void jit_a64_pair(struct JitBuffer *buffer, uint32_t op, uint32_t reg, uint32_t reg2, uint32_t base, int offset)
+{
+    int scale = (op == JIT_A64_LDP_Q || op == JIT_A64_STP_Q) ? 16 : 8;
+    jit_a64(buffer, op | ((uint32_t)(offset / scale) & 0x7f) << 15 | reg2 << 10 | base << 5 | reg);
+}
+
+/// Emits B to the target, 26-bit displacement.
+void jit_a64_branch(struct JitBuffer *buffer, const uint8_t *target)
+{
+    jit_a64(buffer, 0x14000000 | ((uint32_t)((target - buffer->pos) / 4) & 0x03ffffff));
+}
+
+/// Emits a branch to the target if the condition holds. B.cond reaches only 1 MB, so the
+/// inverse condition skips a B.
+void jit_a64_branch_if(struct JitBuffer *buffer, uint32_t condition, const uint8_t *target)
+{
+    jit_a64(buffer, 0x54000000 | 2 << 5 | (condition ^ 1));
+    jit_a64_branch(buffer, target);
+}
+
+/// The word operations of ADD, SUB, AND, OR and XOR: the operation of the least significant
+/// word (ADDS, SUBS or the bitwise one) and of the following ones (ADCS, SBCS).
+struct JitA64WordOp
+{
+    uint32_t first;
+    uint32_t next;
+};
+
+/// The second item = top op second item, and pops the top. x1-x4 are the top words, x5-x8
+/// the second ones, the most significant first.
+void jit_a64_word_op(struct JitBuffer *buffer, struct JitA64WordOp op)
+{
+    jit_a64_astate(buffer, 0xf9400000, 0, JIT_TOP);
+    jit_a64_pair(buffer, JIT_A64_LDP_X, 1, 2, 0, 0);
+    jit_a64_pair(buffer, JIT_A64_LDP_X, 3, 4, 0, 16);
+    jit_a64_pair(buffer, JIT_A64_LDP_X, 5, 6, 0, -32);
+    jit_a64_pair(buffer, JIT_A64_LDP_X, 7, 8, 0, -16);
+    for (uint32_t word = 4; word >= 1; --word)
+    {
+        uint32_t code = word == 4 ? op.first : op.next;
+        // op x(word + 4), x(word), x(word + 4)
+        jit_a64(buffer, code | (word + 4) << 16 | word << 5 | (word + 4));
+    }
+    jit_a64_pair(buffer, JIT_A64_STP_X, 5, 6, 0, -32);
+    jit_a64_pair(buffer, JIT_A64_STP_X, 7, 8, 0, -16);
+    // sub x0, x0, 32; str x0, [x19 + top]
+    jit_a64(buffer, 0xd1000000 | 32 << 10);
+    jit_a64_astate(buffer, 0xf9000000, 0, JIT_TOP);
+}
+
+/// Emits the inlined stencil of the instruction, returns false if it has none.
+bool jit_a64_inline(struct JitBuffer *buffer, const struct Instruction *instr, const uint8_t *exit)
+{
+    instruction_exec_fn fn = instr->fn;
+
+    if (fn == opx_beginblock)
+    {
+        struct BlockInfo block = instr->arg.block;
+        // w2 = gas_cost; x1 = gas_left - x2, stored; exit if negative
+        jit_a64_mov32(buffer, 2, block.gas_cost);
+        jit_a64_astate(buffer, 0xf9400000, 1, JIT_GAS_LEFT);
+        jit_a64(buffer, 0xeb000000 | 2 << 16 | 1 << 5 | 1);
+        jit_a64_astate(buffer, 0xf9000000, 1, JIT_GAS_LEFT);
+        jit_a64_branch_if(buffer, JIT_A64_MI, exit);
+        // The stack size: x1 = (top - bottom) >> 5, sub x1, x0, x1; asr x1, x1, 5.
+        jit_a64_astate(buffer, 0xf9400000, 0, JIT_TOP);
+        jit_a64_astate(buffer, 0xf9400000, 1, JIT_BOTTOM);
+        jit_a64(buffer, 0xcb010001);
+        jit_a64(buffer, 0x9345fc21);
+        // w3 = stack_req; cmp w1, w3; exit if less
+        jit_a64_mov32(buffer, 3, (uint32_t)(int32_t)block.stack_req);
+        jit_a64(buffer, 0x6b03003f);
+        jit_a64_branch_if(buffer, JIT_A64_LT, exit);
+        // w3 = stack_max_growth; add w1, w1, w3; cmp w1, 1024; exit if greater
+        jit_a64_mov32(buffer, 3, (uint32_t)(int32_t)block.stack_max_growth);
+        jit_a64(buffer, 0x0b030021);
+        jit_a64(buffer, 0x7110003f);
+        jit_a64_branch_if(buffer, JIT_A64_GT, exit);
+        // str w2, [x19 + current_block_cost]
+        jit_a64(buffer, 0xb9000000 | (uint32_t)(JIT_BLOCK_COST / 4) << 10 | 19 << 5 | 2);
+        return true;
+    }
+
+    bool push_small = fn == op_push_small;
+    bool push_full = fn == op_push_full;
+    int dup = 0;
+    int swap = 0;
+    static const instruction_exec_fn dups[] = {op_dup1, op_dup2, op_dup3, op_dup4, op_dup5, op_dup6, op_dup7, op_dup8,
+                                               op_dup9, op_dup10, op_dup11, op_dup12, op_dup13, op_dup14, op_dup15, op_dup16};
+    static const instruction_exec_fn swaps[] = {op_swap1, op_swap2, op_swap3, op_swap4, op_swap5, op_swap6, op_swap7, op_swap8,
+                                                op_swap9, op_swap10, op_swap11, op_swap12, op_swap13, op_swap14, op_swap15, op_swap16};
+    for (int n = 0; n < 16; ++n)
+    {
+        if (fn == dups[n])
+            dup = n + 1;
+        if (fn == swaps[n])
+            swap = n + 1;
+    }
+
+    if (push_small || push_full || dup != 0)
+    {
+        // ldr x0, [x19 + top]
+        jit_a64_astate(buffer, 0xf9400000, 0, JIT_TOP);
+        if (push_small)
+        {
+            // The three high words zero: stp xzr, xzr, [x0, 32]; str xzr, [x0, 48]. The low
+            // word: x1 = value; str x1, [x0, 56].
+            jit_a64_pair(buffer, JIT_A64_STP_X, JIT_A64_XZR, JIT_A64_XZR, 0, 32);
+            jit_a64(buffer, 0xf900181f);
+            jit_a64_mov(buffer, 1, instr->arg.small_push_value);
+            jit_a64(buffer, 0xf9001c01);
+        }
+        else
+        {
+            if (push_full)
+            {
+                // x1 = push_value; ldp q0, q1, [x1]
+                jit_a64_mov(buffer, 1, (uint64_t)(uintptr_t)instr->arg.push_value);
+                jit_a64_pair(buffer, JIT_A64_LDP_Q, 0, 1, 1, 0);
+            }
+            else
+                jit_a64_pair(buffer, JIT_A64_LDP_Q, 0, 1, 0, -32 * (dup - 1));
+            jit_a64_pair(buffer, JIT_A64_STP_Q, 0, 1, 0, 32);
+        }
+        // add x0, x0, 32; str x0, [x19 + top]
+        jit_a64(buffer, 0x91000000 | 32 << 10);
+        jit_a64_astate(buffer, 0xf9000000, 0, JIT_TOP);
+        return true;
+    }
+
+    if (swap != 0)
+    {
+        jit_a64_astate(buffer, 0xf9400000, 0, JIT_TOP);
+        jit_a64_pair(buffer, JIT_A64_LDP_Q, 0, 1, 0, 0);
+        jit_a64_pair(buffer, JIT_A64_LDP_Q, 2, 3, 0, -32 * swap);
+        jit_a64_pair(buffer, JIT_A64_STP_Q, 2, 3, 0, 0);
+        jit_a64_pair(buffer, JIT_A64_STP_Q, 0, 1, 0, -32 * swap);
+        return true;
+    }
+
+    if (fn == op_pop)
+    {
+        // ldr x0, [x19 + top]; sub x0, x0, 32; str x0, [x19 + top]
+        jit_a64_astate(buffer, 0xf9400000, 0, JIT_TOP);
+        jit_a64(buffer, 0xd1000000 | 32 << 10);
+        jit_a64_astate(buffer, 0xf9000000, 0, JIT_TOP);
+        return true;
+    }
+
+    // SUB is top - second, the top words being the first operands.
+    if (fn == op_add)
+        jit_a64_word_op(buffer, (struct JitA64WordOp){0xab000000, 0xba000000});
+    else if (fn == op_sub)
+        jit_a64_word_op(buffer, (struct JitA64WordOp){0xeb000000, 0xfa000000});
+    else if (fn == op_and)
+        jit_a64_word_op(buffer, (struct JitA64WordOp){0x8a000000, 0x8a000000});
+    else if (fn == op_or)
+        jit_a64_word_op(buffer, (struct JitA64WordOp){0xaa000000, 0xaa000000});
+    else if (fn == op_xor)
+        jit_a64_word_op(buffer, (struct JitA64WordOp){0xca000000, 0xca000000});
+    else if (fn == op_iszero)
+    {
+        // x1 = the words or'ed; x1 = x1 == 0; the top = x1
+        jit_a64_astate(buffer, 0xf9400000, 0, JIT_TOP);
+        jit_a64_pair(buffer, JIT_A64_LDP_X, 1, 2, 0, 0);
+        jit_a64_pair(buffer, JIT_A64_LDP_X, 3, 4, 0, 16);
+        // orr x1, x1, x2; orr x3, x3, x4; orr x1, x1, x3; cmp x1, 0; cset x1, eq
+        uint32_t test[] = {0xaa020021, 0xaa040063, 0xaa030021, 0xf100003f, 0x9a9f17e1};
+        for (size_t i = 0; i < sizeof(test) / sizeof(test[0]); ++i)
+            jit_a64(buffer, test[i]);
+        jit_a64_pair(buffer, JIT_A64_STP_X, JIT_A64_XZR, JIT_A64_XZR, 0, 0);
+        jit_a64_pair(buffer, JIT_A64_STP_X, JIT_A64_XZR, 1, 0, 16);
+    }
+    else
+        return false;
+    return true;
+}
+
+/// Emits the call of the instruction_exec_fn: exit on NULL, continue with the next stencil on
+/// the next instruction and dispatch any other one.
+void jit_a64_call(struct JitBuffer *buffer, const struct Instruction *instr, const uint8_t *exit, const uint8_t *dispatch)
+{
+    // x0 = instr; mov x1, x19; x9 = fn; blr x9
+    jit_a64_mov(buffer, 0, (uint64_t)(uintptr_t)instr);
+    jit_a64(buffer, 0xaa1303e1);
+    jit_a64_mov(buffer, 9, (uint64_t)(uintptr_t)instr->fn);
+    jit_a64(buffer, 0xd63f0120);
+    // cbnz x0 over the branch to exit
+    jit_a64(buffer, 0xb5000000 | 2 << 5);
+    jit_a64_branch(buffer, exit);
+    // x9 = instr + 1; cmp x0, x9; dispatch if not equal
+    jit_a64_mov(buffer, 9, (uint64_t)(uintptr_t)(instr + 1));
+    jit_a64(buffer, 0xeb09001f);
+    jit_a64_branch_if(buffer, JIT_A64_NE, dispatch);
+}
+
+/// Emits the entry of the native code, as jit_entry().
+void jit_a64_entry(struct JitBuffer *b, const struct Instruction *instrs, uint8_t **addresses, uint8_t **exit, uint8_t **dispatch)
+{
+    // stp x29, x30, [sp, -32]!; mov x29, sp; str x19, [sp, 16]; mov x19, x0; b over the stubs
+    uint32_t prologue[] = {0xa9be7bfd, 0x910003fd, 0xf9000bf3, 0xaa0003f3};
+    for (size_t i = 0; i < sizeof(prologue) / sizeof(prologue[0]); ++i)
+        jit_a64(b, prologue[i]);
+    uint8_t *start = b->pos;
+    b->pos += 4;
+
+    // exit: ldr x19, [sp, 16]; ldp x29, x30, [sp], 32; ret
+    *exit = b->pos;
+    uint32_t epilogue[] = {0xf9400bf3, 0xa8c27bfd, 0xd65f03c0};
+    for (size_t i = 0; i < sizeof(epilogue) / sizeof(epilogue[0]); ++i)
+        jit_a64(b, epilogue[i]);
+
+    // dispatch: br [addresses + (x0 - instrs) / sizeof(struct Instruction) * 8]
+    *dispatch = b->pos;
+    jit_a64_mov(b, 9, (uint64_t)(uintptr_t)instrs);
+    // sub x0, x0, x9; lsr x0, x0, log2(sizeof(struct Instruction))
+    jit_a64(b, 0xcb090000);
+    jit_a64(b, 0xd340fc00 | (uint32_t)__builtin_ctzl(sizeof(struct Instruction)) << 16);
+    jit_a64_mov(b, 9, (uint64_t)(uintptr_t)addresses);
+    // ldr x9, [x9, x0, lsl 3]; br x9
+    jit_a64(b, 0xf8607929);
+    jit_a64(b, 0xd61f0120);
+
+    struct JitBuffer entry = {start};
+    jit_a64_branch(&entry, b->pos);
+}
+
+/// Compiles the analysis, which must outlive the native code. Returns false if the JIT is
+/// not available.
+bool jit_compile(struct JitCode *jit, struct CodeAnalysis *analysis)
+{
+    // The dispatch turns the instruction pointer into an index with a shift.
+    if (!JIT_AVAILABLE || (sizeof(struct Instruction) & (sizeof(struct Instruction) - 1)) != 0)
+        return false;
+
+    size_t n = analysis->instrs_size;
+    size_t code_size = 128 + n * JIT_MAX_STENCIL_SIZE;
+    jit->size = (code_size + n * sizeof(uint8_t *) + 4095) & ~(size_t)4095;
+    void *mapping = mmap(NULL, jit->size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED)
+        return false;
+    jit->code = (uint8_t *)mapping;
+    uint8_t **addresses = (uint8_t **)(jit->code + code_size);
+
+    struct JitBuffer buffer = {jit->code};
+    struct JitBuffer *b = &buffer;
+
+    uint8_t *exit;
+    uint8_t *dispatch;
+    if (JIT_ARCH == JIT_ARCH_AARCH64)
+        jit_a64_entry(b, analysis->instrs, addresses, &exit, &dispatch);
+    else
+        jit_entry(b, analysis->instrs, addresses, &exit, &dispatch);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        const struct Instruction *instr = &analysis->instrs[i];
+        addresses[i] = b->pos;
+        if (JIT_ARCH == JIT_ARCH_AARCH64)
+        {
+            if (!jit_a64_inline(b, instr, exit))
+                jit_a64_call(b, instr, exit, dispatch);
+        }
+        else if (!jit_inline(b, instr, exit))
+            jit_call(b, instr, exit, dispatch);
+        assert(b->pos - addresses[i] <= JIT_MAX_STENCIL_SIZE);
+    }
+    // The last instruction is a terminator, running past it is never reached.
+    if (JIT_ARCH == JIT_ARCH_AARCH64)
+        jit_a64_branch(b, exit);
+    else
+        jit_jump(b, 0, exit);
+    // The instruction cache of AArch64 is not coherent with the stores of the code.
+    __builtin___clear_cache((char *)jit->code, (char *)b->pos);
+
+    if (mprotect(mapping, jit->size, PROT_READ | PROT_EXEC) != 0)
+    {
+        munmap(mapping, jit->size);
+        return false;
+    }
+    jit->entry = (jit_fn)(void *)jit->code;
+    return true;
+}
+
+void JitCode_free(struct JitCode *jit)
+{
+    munmap(jit->code, jit->size);
+}
+
+/// The maximum number of compiled contracts kept.
+#define JIT_CACHE_ENTRIES 8
+
+struct JitCacheEntry
+{
+    /// The key, as for the AnalysisCache.
+    uint64_t code_hash;
+    uint8_t *code;
+    size_t code_size;
+    enum evmc_revision rev;
+
+    /// The analysis the native code has been compiled from, owned by the entry as the native
+    /// code embeds pointers into it.
+    struct CodeAnalysis analysis;
+    struct JitCode jit;
+
+    /// The JitCache::clock value of the last use, 0 if the entry is empty.
+    uint64_t last_use;
+};
+
+/// The compiled contracts with the least recently used one evicted first.
+struct JitCache
+{
+    struct JitCacheEntry entries[JIT_CACHE_ENTRIES];
+    uint64_t clock;
+};
+
+struct JitCache jit_cache;
+
+/// Returns the compiled entry of the code, NULL if the JIT is not available.
+struct JitCacheEntry *JitCache_get(struct JitCache *cache, enum evmc_revision rev, uint8_t *code, size_t code_size)
+{
+    uint64_t code_hash = code_hash64(code, code_size);
+    ++cache->clock;
+
+    struct JitCacheEntry *slot = NULL;
+    for (size_t i = 0; i < JIT_CACHE_ENTRIES; ++i)
+    {
+        struct JitCacheEntry *entry = &cache->entries[i];
+        if (entry->last_use != 0 && entry->code_hash == code_hash && entry->code_size == code_size &&
+            entry->rev == rev && memcmp(entry->code, code, code_size) == 0)
+        {
+            entry->last_use = cache->clock;
+            return entry;
+        }
+        if (slot == NULL || entry->last_use < slot->last_use)
+            slot = entry;
+    }
+
+    struct CodeAnalysis analysis = analyze(rev, code, code_size);
+    struct JitCode jit;
+    if (!jit_compile(&jit, &analysis))
+    {
+        CodeAnalysis_free(&analysis);
+        return NULL;
+    }
+
+    if (slot->last_use != 0)
+    {
+        JitCode_free(&slot->jit);
+        CodeAnalysis_free(&slot->analysis);
+        free(slot->code);
+    }
+    slot->code_hash = code_hash;
+    slot->code = (uint8_t *)malloc(code_size);
+    memcpy(slot->code, code, code_size);
+    slot->code_size = code_size;
+    slot->rev = rev;
+    slot->analysis = analysis;
+    slot->jit = jit;
+    slot->last_use = cache->clock;
+    return slot;
+}
+
+struct evmc_result execute_jit(struct evmc_vm* vm, struct evmc_host_context *ctx, enum evmc_revision rev, struct evmc_message *msg, uint8_t *code, size_t code_size)
+{
+    const struct AotContract *contract = aot_find(rev, code, code_size);
+    if (contract != NULL)
+        return execute_aot(contract, ctx, rev, msg, code, code_size);
+    struct JitCacheEntry *entry = JitCache_get(&jit_cache, rev, code, code_size);
+    if (entry == NULL)
+        return execute(vm, ctx, rev, msg, code, code_size);
+
+    struct AdvancedExecutionState* astate = ExecutionStatePool_acquire(&execution_state_pool, msg, rev, ctx, code, code_size);
+    struct ExecutionState* state = &astate->estate;
+    state->analysis.advanced = &entry->analysis;
+
+    entry->jit.entry(astate);
+
+    size_t gas_left = (state->status == EVMC_SUCCESS || state->status == EVMC_REVERT) ? state->gas_left : 0;
+    assert(state->output_size != 0 || state->output_offset == 0);
+    struct evmc_result result = evmc_make_result(state->status, gas_left, Memory_data(&(state->memory)) + state->output_offset, state->output_size);
+
+    ExecutionStatePool_release(&execution_state_pool, astate);
+    return result;
+}
@@ -1,4 +1,6 @@
 #include "execution.h"
+#include "jit.h"
+#include "baseline.h"
 
 void destroy(struct evmc_vm* vm)
 {
@@ -12,13 +14,30 @@ evmc_capabilities_flagset get_capabilities(struct evmc_vm* vm)
     return EVMC_CAPABILITY_EVM1;
 }
 
+/// The gas limit per code byte below which execute_auto() picks the baseline interpreter.
+///
+/// The gas limit bounds the work of the call. The analysis for the advanced interpreter costs
+/// about what the baseline interpreter loses to it in 100 gas of execution per code byte,
+/// so calls limited to less than that are cheaper without the analysis.
+#define BASELINE_AUTO_GAS_PER_CODE_BYTE 100
+
+struct evmc_result execute_auto(struct evmc_vm* vm, struct evmc_host_context *ctx, enum evmc_revision rev, struct evmc_message *msg, uint8_t *code, size_t code_size)
+{
+    const struct AotContract *contract = aot_find(rev, code, code_size);
+    if (contract != NULL)
+        return execute_aot(contract, ctx, rev, msg, code, code_size);
+    if (msg->gas < (int64_t)code_size * BASELINE_AUTO_GAS_PER_CODE_BYTE)
+        return execute_baseline(vm, ctx, rev, msg, code, code_size);
+    return execute(vm, ctx, rev, msg, code, code_size);
+}
+
 enum evmc_set_option_result set_option(struct evmc_vm* c_vm, char const* c_name, char const* c_value)
 {
     if (strcmp(c_name, "O") == 0)
     {
         if (strcmp(c_value, "0") == 0)
         {
-            c_vm->execute = execute;
+            c_vm->execute = execute_baseline;
             return EVMC_SET_OPTION_SUCCESS;
         }
         else if (strcmp(c_value, "2") == 0)
@@ -26,8 +45,69 @@ enum evmc_set_option_result set_option(struct evmc_vm* c_vm, char const* c_name,
             c_vm->execute = execute;
             return EVMC_SET_OPTION_SUCCESS;
         }
+        else if (strcmp(c_value, "3") == 0)
+        {
+            // Same analysis as "2", executed with the threaded dispatch.
+            c_vm->execute = execute_threaded;
+            return EVMC_SET_OPTION_SUCCESS;
+        }
+        else if (strcmp(c_value, "jit") == 0)
+        {
+            // Same analysis as "2", compiled to native code where the JIT is available.
+            c_vm->execute = execute_jit;
+            return EVMC_SET_OPTION_SUCCESS;
+        }
+        else if (strcmp(c_value, "auto") == 0)
+        {
+            // Baseline or advanced per call, by the code size and the gas limit.
+            c_vm->execute = execute_auto;
+            return EVMC_SET_OPTION_SUCCESS;
+        }
         return EVMC_SET_OPTION_INVALID_VALUE;
     }
+    if (strcmp(c_name, "jumpdest_index") == 0)
+    {
+        if (strcmp(c_value, "auto") == 0)
+            jumpdest_index_option = JUMPDEST_INDEX_AUTO;
+        else if (strcmp(c_value, "search") == 0)
+            jumpdest_index_option = JUMPDEST_INDEX_SEARCH;
+        else if (strcmp(c_value, "bitmap") == 0)
+            jumpdest_index_option = JUMPDEST_INDEX_BITMAP;
+        else if (strcmp(c_value, "dense") == 0)
+            jumpdest_index_option = JUMPDEST_INDEX_DENSE;
+        else
+            return EVMC_SET_OPTION_INVALID_VALUE;
+        return EVMC_SET_OPTION_SUCCESS;
+    }
+    if (strcmp(c_name, "analysis") == 0)
+    {
+        if (strcmp(c_value, "auto") == 0)
+            analysis_mode_option = ANALYSIS_AUTO;
+        else if (strcmp(c_value, "eager") == 0)
+            analysis_mode_option = ANALYSIS_EAGER;
+        else if (strcmp(c_value, "lazy") == 0)
+            analysis_mode_option = ANALYSIS_LAZY;
+        else
+            return EVMC_SET_OPTION_INVALID_VALUE;
+        return EVMC_SET_OPTION_SUCCESS;
+    }
+    if (strcmp(c_name, "aot") == 0)
+    {
+        // Whether the contracts compiled ahead of time run their translations, see aot.h.
+        if (strcmp(c_value, "on") == 0)
+            aot_enabled = true;
+        else if (strcmp(c_value, "off") == 0)
+            aot_enabled = false;
+        else
+            return EVMC_SET_OPTION_INVALID_VALUE;
+        return EVMC_SET_OPTION_SUCCESS;
+    }
+    if (strcmp(c_name, "analysis_store") == 0)
+    {
+        // The directory of the stored analyses, empty to disable the store.
+        analysis_store_dir = c_value[0] != '\0' ? c_value : NULL;
+        return EVMC_SET_OPTION_SUCCESS;
+    }
     return EVMC_SET_OPTION_INVALID_NAME;
 }
 
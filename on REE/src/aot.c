@@ -0,0 +1,332 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "analysis_cache.h"
+#include "hex_helpers.h"
+
+/// The ahead-of-time translator: writes the C translation of contracts, see aot.h.
+///
+///     tsc-vee-aot [-r revision] -o aot_contracts.h name=bytecode.txt[:offset:size]...
+///
+/// A contract is read from a file holding its bytecode in hex, the name is the C identifier
+/// of its translation. The offset and the size select a part of the code, such as the runtime
+/// code a creation code returns. The revision is the evmc_revision number, London by default.
+
+/// The instruction kinds and stack changes of instructions_xmacro.h, as the macro names of aot.h.
+static const struct
+{
+    const char *impl;
+    const char *kind;
+    int change;
+} aot_ops[256] = {
+#define X(opcode, identifier, impl, kind, required, change, since) [opcode] = {#impl, #kind, change},
+    MAP_OPCODE_TO_IDENTIFIER
+#undef X
+};
+
+/// Reads the bytecode in hex from the file, "0x" and whitespace allowed.
+static uint8_t *read_code(const char *path, size_t *code_size)
+{
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL)
+        return NULL;
+    fseek(fp, 0, SEEK_END);
+    long length = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    char *text = (char *)malloc((size_t)length + 1);
+    size_t read = fread(text, 1, (size_t)length, fp);
+    fclose(fp);
+    text[read] = '\0';
+
+    char *digits = text;
+    if (digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X'))
+        digits += 2;
+    uint8_t *code = (uint8_t *)malloc(read / 2 + 1);
+    size_t size = 0;
+    int high = -1;
+    for (char *c = digits; *c != '\0'; ++c)
+    {
+        if (*c == ' ' || *c == '\t' || *c == '\r' || *c == '\n')
+            continue;
+        int digit = from_hex_digit(*c);
+        if (high < 0)
+            high = digit;
+        else
+        {
+            code[size++] = (uint8_t)(high << 4 | digit);
+            high = -1;
+        }
+    }
+    free(text);
+    *code_size = size;
+    return code;
+}
+
+static bool is_jumpdest(const uint64_t *jumpdests, uint64_t offset, size_t code_size)
+{
+    return offset < code_size && (jumpdests[offset / 64] & ((uint64_t)1 << (offset % 64))) != 0;
+}
+
+/// Returns the value of the PUSH at the position, the bytes after the end of the code read as zeros.
+static void read_push(const uint8_t *code, size_t code_size, size_t pos, uint8_t buffer[32])
+{
+    size_t push_size = (size_t)(code[pos] - OP_PUSH1) + 1;
+    memset(buffer, 0, 32);
+    for (size_t i = 0; i < push_size && pos + 1 + i < code_size; ++i)
+        buffer[32 - push_size + i] = code[pos + 1 + i];
+}
+
+/// The instruction of a block, with the gas cost of the block up to and including it.
+struct AotInstr
+{
+    size_t pos;
+    int64_t gas_cost;
+};
+
+/// Writes the statements of a block: its check and its instructions but the JUMPDEST.
+static void write_block(FILE *out, enum evmc_revision rev, const uint8_t *code, size_t code_size,
+                        const uint64_t *jumpdests, const struct AotInstr *instrs,
+                        size_t size, struct BlockInfo block)
+{
+    if (size != 0 && code[instrs[0].pos] == OP_JUMPDEST)
+        fprintf(out, "L_%04zx:\n", instrs[0].pos);
+    fprintf(out, "    AOT_BLOCK(%" PRIu32 ", %d, %d);\n", block.gas_cost, block.stack_req, block.stack_max_growth);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        size_t pos = instrs[i].pos;
+        uint8_t opcode = code[pos];
+        uint8_t next = i + 1 < size ? code[instrs[i + 1].pos] : OP_STOP;
+
+        if (gas_costs[rev][opcode] == undefined)
+        {
+            fprintf(out, "    AOT_EXIT(EVMC_UNDEFINED_INSTRUCTION);\n");
+            continue;
+        }
+
+        switch (opcode)
+        {
+        case OP_JUMPDEST:
+            break;
+
+        case OP_STOP:
+            fprintf(out, "    AOT_EXIT(EVMC_SUCCESS);\n");
+            break;
+
+        case OP_INVALID:
+            fprintf(out, "    AOT_EXIT(EVMC_INVALID_INSTRUCTION);\n");
+            break;
+
+        case OP_RETURN:
+        case OP_REVERT:
+        case OP_SELFDESTRUCT:
+            fprintf(out, "    AOT_TERMINATE(%s);\n", aot_ops[opcode].impl);
+            break;
+
+        case OP_JUMP:
+            fprintf(out, "    AOT_JUMP();\n");
+            break;
+
+        case OP_JUMPI:
+            fprintf(out, "    AOT_JUMPI();\n");
+            break;
+
+        case OP_PC:
+            fprintf(out, "    AOT_PUSH_SMALL(0x%zx);\n", pos);
+            break;
+
+        case OP_GAS:
+            fprintf(out, "    AOT_GAS(%" PRId64 ");\n", (int64_t)block.gas_cost - instrs[i].gas_cost);
+            break;
+
+        case ANY_SMALL_PUSH:
+        {
+            uint8_t buffer[32];
+            read_push(code, code_size, pos, buffer);
+            uint64_t value = readUint64BE(buffer + 24);
+
+            // The jump to a PUSHed destination.
+            if (next == OP_JUMP || next == OP_JUMPI)
+            {
+                bool valid = is_jumpdest(jumpdests, value, code_size);
+                if (next == OP_JUMP && valid)
+                    fprintf(out, "    goto L_%04" PRIx64 ";\n", value);
+                else if (next == OP_JUMP)
+                    fprintf(out, "    AOT_EXIT(EVMC_BAD_JUMP_DESTINATION);\n");
+                else if (valid)
+                    fprintf(out, "    AOT_STATIC_JUMPI(L_%04" PRIx64 ");\n", value);
+                else
+                    fprintf(out, "    AOT_BAD_JUMPI();\n");
+                ++i;
+                break;
+            }
+            fprintf(out, "    AOT_PUSH_SMALL(0x%" PRIx64 ");\n", value);
+            break;
+        }
+
+        case ANY_LARGE_PUSH:
+        {
+            uint8_t buffer[32];
+            read_push(code, code_size, pos, buffer);
+            fprintf(out, "    AOT_PUSH(0x%" PRIx64 ", 0x%" PRIx64 ", 0x%" PRIx64 ", 0x%" PRIx64 ");\n",
+                    readUint64BE(buffer), readUint64BE(buffer + 8), readUint64BE(buffer + 16), readUint64BE(buffer + 24));
+            break;
+        }
+
+        default:
+            if (strcmp(aot_ops[opcode].kind, "GAS_CORRECTION") == 0)
+                fprintf(out, "    AOT_GAS_CORRECTION(%s, %d, %" PRId64 ");\n", aot_ops[opcode].impl, aot_ops[opcode].change,
+                        (int64_t)block.gas_cost - instrs[i].gas_cost);
+            else
+                fprintf(out, "    AOT_%s(%s, %d);\n", aot_ops[opcode].kind, aot_ops[opcode].impl, aot_ops[opcode].change);
+            break;
+        }
+    }
+}
+
+/// Writes the code, the translation and the registry entry initializer of a contract.
+///
+/// The code is split into the blocks of analyze(), which also charges the opcode 247 as free.
+static void aot_write_contract(FILE *out, FILE *entries, const char *name, enum evmc_revision rev,
+                               const uint8_t *code, size_t code_size)
+{
+    // The jump destinations, and whether any jump takes its destination from the stack.
+    uint64_t *jumpdests = (uint64_t *)calloc(code_size / 64 + 1, sizeof(uint64_t));
+    bool dynamic_jumps = false;
+    uint8_t previous = OP_STOP;
+    for (size_t pos = 0; pos < code_size; ++pos)
+    {
+        uint8_t opcode = code[pos];
+        if (opcode == OP_JUMPDEST)
+            jumpdests[pos / 64] |= (uint64_t)1 << (pos % 64);
+        else if ((opcode == OP_JUMP || opcode == OP_JUMPI) && !(previous >= OP_PUSH1 && previous <= OP_PUSH8))
+            dynamic_jumps = true;
+        if (opcode >= OP_PUSH1 && opcode <= OP_PUSH32)
+            pos += (size_t)(opcode - OP_PUSH1) + 1;
+        previous = opcode;
+    }
+
+    fprintf(out, "const uint8_t aot_%s_code[%zu] = {", name, code_size != 0 ? code_size : 1);
+    for (size_t pos = 0; pos < code_size; ++pos)
+        fprintf(out, "%s0x%02x,", pos % 16 == 0 ? "\n    " : " ", code[pos]);
+    fprintf(out, "\n};\n\n");
+
+    fprintf(out, "struct evmc_result aot_%s(struct ExecutionState *state)\n{\n", name);
+    fprintf(out, "    struct uint256_t *bottom = StackSpace_bottom(&state->stack_space);\n");
+    fprintf(out, "    struct uint256_t *top = bottom;\n");
+    if (dynamic_jumps)
+        fprintf(out, "    struct uint256_t *destination;\n");
+    fprintf(out, "    enum evmc_status_code status;\n");
+
+    struct AotInstr *instrs = (struct AotInstr *)malloc((code_size + 1) * sizeof(struct AotInstr));
+    size_t size = 0;
+    struct BlockAnalysis block;
+    BlockAnalysis_init(&block);
+    for (size_t pos = 0; pos < code_size; ++pos)
+    {
+        uint8_t opcode = code[pos];
+        struct OpTableEntry opcode_info = op_table_entry(rev, opcode);
+        if (opcode == 247)
+        {
+            opcode_info.stack_req = 0;
+            opcode_info.stack_change = 0;
+            opcode_info.gas_cost = 0;
+        }
+        block.stack_req = max(block.stack_req, opcode_info.stack_req - block.stack_change);
+        block.stack_change += opcode_info.stack_change;
+        block.stack_max_growth = max(block.stack_max_growth, block.stack_change);
+        block.gas_cost += opcode_info.gas_cost;
+        instrs[size++] = (struct AotInstr){pos, block.gas_cost};
+
+        if (opcode >= OP_PUSH1 && opcode <= OP_PUSH32)
+            pos += (size_t)(opcode - OP_PUSH1) + 1;
+
+        bool is_terminator = opcode == OP_JUMP || opcode == OP_JUMPI || opcode == OP_STOP ||
+                             opcode == OP_RETURN || opcode == OP_REVERT || opcode == OP_SELFDESTRUCT;
+        if (is_terminator || (pos + 1 < code_size && code[pos + 1] == OP_JUMPDEST))
+        {
+            fprintf(out, "\n    // 0x%04zx\n", instrs[0].pos);
+            write_block(out, rev, code, code_size, jumpdests, instrs, size, BlockAnalysis_close(&block));
+            size = 0;
+            BlockAnalysis_init(&block);
+        }
+    }
+    // The end of the code executes STOP.
+    fprintf(out, "\n    // 0x%04zx\n", code_size);
+    write_block(out, rev, code, code_size, jumpdests, instrs, size, BlockAnalysis_close(&block));
+    fprintf(out, "    AOT_EXIT(EVMC_SUCCESS);\n");
+
+    if (dynamic_jumps)
+    {
+        fprintf(out, "\njump:\n    AOT_DISPATCH(destination)\n    {\n");
+        for (size_t pos = 0; pos < code_size; ++pos)
+        {
+            if (is_jumpdest(jumpdests, pos, code_size))
+                fprintf(out, "    case 0x%zx:\n        goto L_%04zx;\n", pos, pos);
+        }
+        fprintf(out, "    }\n    AOT_EXIT(EVMC_BAD_JUMP_DESTINATION);\n");
+    }
+    fprintf(out, "\nexit:\n    return aot_result(state, status);\n}\n\n");
+
+    fprintf(entries, "    {\"%s\", %d, aot_%s_code, %zu, 0x%016" PRIx64 "ULL, aot_%s},\n", name, (int)rev, name, code_size,
+            code_hash64((uint8_t *)code, code_size), name);
+
+    free(instrs);
+    free(jumpdests);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *output = NULL;
+    enum evmc_revision rev = EVMC_LONDON;
+    int first = 1;
+    for (; first + 1 < argc && argv[first][0] == '-'; first += 2)
+    {
+        if (strcmp(argv[first], "-o") == 0)
+            output = argv[first + 1];
+        else if (strcmp(argv[first], "-r") == 0)
+            rev = (enum evmc_revision)atoi(argv[first + 1]);
+    }
+    if (output == NULL || first == argc || rev < 0 || rev > EVMC_MAX_REVISION)
+    {
+        fprintf(stderr, "usage: %s [-r revision] -o aot_contracts.h name=bytecode.txt...\n", argv[0]);
+        return 1;
+    }
+
+    FILE *out = fopen(output, "w");
+    char *entries_text = NULL;
+    size_t entries_size = 0;
+    FILE *entries = open_memstream(&entries_text, &entries_size);
+    if (out == NULL || entries == NULL)
+    {
+        fprintf(stderr, "cannot write %s\n", output);
+        return 1;
+    }
+
+    fprintf(out, "#pragma once\n\n/// Generated by tsc-vee-aot (src/aot.c), do not edit.\n\n");
+    for (int i = first; i < argc; ++i)
+    {
+        char *path = strchr(argv[i], '=');
+        size_t offset = 0;
+        size_t size = SIZE_MAX;
+        char *colon = path != NULL ? strchr(path, ':') : NULL;
+        if (colon != NULL && sscanf(colon, ":%zi:%zi", &offset, &size) == 2)
+            *colon = '\0';
+        size_t code_size;
+        uint8_t *code = path != NULL ? read_code(path + 1, &code_size) : NULL;
+        if (code == NULL || offset > code_size)
+        {
+            fprintf(stderr, "cannot read %s\n", argv[i]);
+            return 1;
+        }
+        *path = '\0';
+        aot_write_contract(out, entries, argv[i], rev, code + offset, min(size, code_size - offset));
+        free(code);
+    }
+
+    fclose(entries);
+    fprintf(out, "const struct AotContract aot_contracts[] = {\n%s};\n", entries_text);
+    fclose(out);
+    free(entries_text);
+    return 0;
+}
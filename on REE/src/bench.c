@@ -0,0 +1,206 @@
+#include <stdio.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "uint256.h"
+#include "vm.h"
+
+/// Returns the current wall-clock time in microseconds.
+static long int now_us()
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+/// EXP micro-benchmark.
+///
+/// Runs exp256() with exponents of growing bit length. The worst case for every length is
+/// an exponent with all bits set (one squaring and one multiplication per bit), so the
+/// time per exponent bit has to stay flat for the engine to be bounded by the charged gas.
+static void bench_exp(int iterations)
+{
+    struct uint256_t base = {0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f3ULL};
+    struct uint256_t result;
+
+    printf("%-28s %8s %12s %12s\n", "exp", "bits", "ns/op", "ns/bit");
+    for (uint32_t bits = 8; bits <= 256; bits *= 2)
+    {
+        struct uint256_t zero = {0, 0, 0, 0};
+        struct uint256_t one = {0, 0, 0, 1};
+        struct uint256_t exponent;
+        if (bits == 256)
+            not256(&zero, &exponent);
+        else
+        {
+            shiftl256(&one, bits, &exponent);
+            minus256(&exponent, &one, &exponent);
+        }
+
+        long int start = now_us();
+        for (int i = 0; i < iterations; ++i)
+            exp256(&base, &exponent, &result);
+        long int elapsed = now_us() - start;
+
+        double ns = elapsed * 1000.0 / iterations;
+        printf("%-28s %8u %12.1f %12.2f\n", "exp/worst_case", bits, ns, ns / bits);
+    }
+
+    // 2**255: handled as a single shift.
+    struct uint256_t two = {0, 0, 0, 2};
+    struct uint256_t e255 = {0, 0, 0, 255};
+    long int start = now_us();
+    for (int i = 0; i < iterations; ++i)
+        exp256(&two, &e255, &result);
+    long int elapsed = now_us() - start;
+    printf("%-28s %8u %12.1f\n", "exp/pow2_base", 8, elapsed * 1000.0 / iterations);
+}
+
+/// Division micro-benchmark: DIV by 2^224 (selector extraction), word and multi-word
+/// divisors, and MULMOD with a full 512-bit intermediate product.
+static void bench_div(int iterations)
+{
+    struct uint256_t calldata = {0xa9059cbb00000000ULL, 0, 0x1111111111111111ULL, 0x2222222222222222ULL};
+    struct uint256_t large = {0xfedcba9876543210ULL, 0x0123456789abcdefULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL};
+    struct uint256_t selector_shift = {0x0000000100000000ULL, 0, 0, 0};
+    struct uint256_t word = {0, 0, 0, 0x3b9aca07ULL};
+    struct uint256_t two_words = {0, 0, 0xc2ad3b6e2a0f1e6bULL, 0x9d1c2e3f4a5b6c7dULL};
+    struct uint256_t three_words = {0, 0x00000000abcdef01ULL, 0x23456789abcdef01ULL, 0x23456789abcdef01ULL};
+    struct uint256_t div, mod;
+
+    struct
+    {
+        const char *name;
+        struct uint256_t *l;
+        struct uint256_t *r;
+    } cases[] = {
+        {"div/selector", &calldata, &selector_shift},
+        {"div/word", &large, &word},
+        {"div/two_words", &large, &two_words},
+        {"div/three_words", &large, &three_words},
+    };
+
+    printf("%-28s %12s\n", "div", "ns/op");
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); ++c)
+    {
+        long int start = now_us();
+        for (int i = 0; i < iterations; ++i)
+            divmod256(cases[c].l, cases[c].r, &div, &mod);
+        long int elapsed = now_us() - start;
+        printf("%-28s %12.1f\n", cases[c].name, elapsed * 1000.0 / iterations);
+    }
+
+    long int start = now_us();
+    for (int i = 0; i < iterations; ++i)
+        mulmod256(&large, &calldata, &three_words, &mod);
+    long int elapsed = now_us() - start;
+    printf("%-28s %12.1f\n", "mulmod/three_words", elapsed * 1000.0 / iterations);
+}
+
+/// Runs the code until it runs out of gas with every jump destination index.
+static void bench_code(const char *name, uint8_t *code, size_t code_size, int iterations)
+{
+    static const char *const index_names[] = {"auto", "search", "bitmap", "dense"};
+
+    MockedHost *host = (MockedHost *)malloc(sizeof(MockedHost));
+    MockedHost_init(host);
+    struct evmc_message *msg = (struct evmc_message *)malloc(sizeof(struct evmc_message));
+    EVMCMessage_init_v(msg, 1000000, NULL, 0);
+
+    for (int kind = JUMPDEST_INDEX_SEARCH; kind <= JUMPDEST_INDEX_DENSE; ++kind)
+    {
+        jumpdest_index_option = (enum jumpdest_index_kind)kind;
+        struct CodeAnalysis analysis = analyze(EVMC_LONDON, code, code_size);
+
+        long int start = now_us();
+        for (int i = 0; i < iterations; ++i)
+        {
+            struct AdvancedExecutionState *astate = ExecutionStatePool_acquire(&execution_state_pool, msg, EVMC_LONDON, (struct evmc_host_context *)host, code, code_size);
+            execute_analyzed_code(astate, &analysis);
+            ExecutionStatePool_release(&execution_state_pool, astate);
+        }
+        long int elapsed = now_us() - start;
+        printf("%-28s %8s %12.1f\n", name, index_names[kind], elapsed * 1000.0 / iterations);
+        CodeAnalysis_free(&analysis);
+    }
+    jumpdest_index_option = JUMPDEST_INDEX_AUTO;
+}
+
+/// Dynamic jump micro-benchmarks, ported from the evmone synthetic benchmarks.
+///
+/// The destinations are offset by CALLDATASIZE, 0 for the empty calldata, so the analysis can
+/// neither fold them into a PUSH nor resolve the jumps statically, and every jump goes through
+/// find_jumpdest(). Both programs loop until they run out of gas.
+static void bench_jump(int iterations)
+{
+    // jump_around: 256 blocks of JUMPDEST PUSH2 next CALLDATASIZE ADD JUMP, visited in a
+    // scattered order so consecutive lookups hit distant parts of the index.
+    enum { blocks = 256, block_size = 7 };
+    uint8_t around[blocks * block_size];
+    for (int i = 0; i < blocks; ++i)
+    {
+        int next = ((i * 97 + 1) % blocks) * block_size;
+        uint8_t block[block_size] = {OP_JUMPDEST, OP_PUSH2, (uint8_t)(next >> 8), (uint8_t)next, OP_CALLDATASIZE, OP_ADD, OP_JUMP};
+        memcpy(around + i * block_size, block, block_size);
+    }
+
+    // loop_with_many_jumpdests: 4096 consecutive JUMPDESTs and a jump back to the first one.
+    enum { jumpdests = 4096 };
+    uint8_t loop[jumpdests + 5];
+    memset(loop, OP_JUMPDEST, jumpdests);
+    uint8_t back[5] = {OP_PUSH1, 0, OP_CALLDATASIZE, OP_ADD, OP_JUMP};
+    memcpy(loop + jumpdests, back, sizeof(back));
+
+    printf("%-28s %8s %12s\n", "jump", "index", "ns/op");
+    bench_code("jump_around", around, sizeof(around), iterations);
+    bench_code("loop_with_many_jumpdests", loop, sizeof(loop), iterations);
+}
+
+/// Memory growth micro-benchmarks, ported from the evmone synthetic benchmarks.
+///
+/// A loop of MLOAD or MSTORE at an offset advancing by the step until the execution runs out
+/// of gas: the step 0 does not grow the memory, the others grow it by one word every 32 / step
+/// iterations, up to about 700 KB with the gas limit of 1000000.
+static void bench_memory(int iterations)
+{
+    MockedHost *host = (MockedHost *)malloc(sizeof(MockedHost));
+    MockedHost_init(host);
+    struct evmc_message *msg = (struct evmc_message *)malloc(sizeof(struct evmc_message));
+    EVMCMessage_init_v(msg, 1000000, NULL, 0);
+
+    static const char *const names[] = {"memory_grow_mload", "memory_grow_mstore"};
+    static const uint8_t steps[] = {0, 1, 16, 32};
+
+    printf("%-28s %8s %12s\n", "memory", "step", "ns/op");
+    for (int store = 0; store <= 1; ++store)
+    {
+        for (size_t s = 0; s < sizeof(steps); ++s)
+        {
+            // PUSH1 0 JUMPDEST DUP1 (DUP1 MSTORE | MLOAD POP) PUSH1 step ADD PUSH1 2 JUMP
+            uint8_t code[] = {OP_PUSH1, 0, OP_JUMPDEST, OP_DUP1, store ? OP_DUP1 : OP_MLOAD, store ? OP_MSTORE : OP_POP,
+                              OP_PUSH1, steps[s], OP_ADD, OP_PUSH1, 2, OP_JUMP};
+
+            long int start = now_us();
+            for (int i = 0; i < iterations; ++i)
+                execute(NULL, (struct evmc_host_context *)host, EVMC_LONDON, msg, code, sizeof(code));
+            long int elapsed = now_us() - start;
+            printf("%-28s %8u %12.1f\n", names[store], steps[s], elapsed * 1000.0 / iterations);
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const char *name = argc > 1 ? argv[1] : "all";
+    int iterations = 100000;
+
+    if (strcmp(name, "all") == 0 || strcmp(name, "exp") == 0)
+        bench_exp(iterations);
+    if (strcmp(name, "all") == 0 || strcmp(name, "div") == 0)
+        bench_div(iterations);
+    if (strcmp(name, "all") == 0 || strcmp(name, "jump") == 0)
+        bench_jump(iterations / 1000);
+    if (strcmp(name, "all") == 0 || strcmp(name, "memory") == 0)
+        bench_memory(iterations / 1000);
+    return 0;
+}
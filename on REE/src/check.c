@@ -0,0 +1,79 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "vm.h"
+
+/// Regression programs, executed by every engine and both analysis modes, with the result
+/// the baseline interpreter gives.
+struct Regression
+{
+    const char *name;
+    const char *code;
+    int64_t gas;
+
+    enum evmc_status_code status;
+    int64_t gas_used;
+    const char *output;
+};
+
+static const struct Regression regressions[] = {
+    // Three PUSH32 values folded from NOTs, more than the code_size / 10 + 1 constants the
+    // pushes of 17 bytes of code can have.
+    {"fold_not_push32", "60011960021960031960005260206000f3", 100000, EVMC_SUCCESS, 33,
+     "fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffc"},
+    // DIV by a pushed power of two, reduced to SHR.
+    {"fold_div_pow2", "600260080460005260206000f3", 100000, EVMC_SUCCESS, 26,
+     "0000000000000000000000000000000000000000000000000000000000000004"},
+};
+
+static const char *const engines[] = {"0", "2", "3", "jit", "auto"};
+static const char *const analysis_modes[] = {"eager", "lazy"};
+
+static size_t unhex(const char *hex, uint8_t *data)
+{
+    size_t size = strlen(hex) / 2;
+    for (size_t i = 0; i < size; ++i)
+        sscanf(hex + 2 * i, "%2hhx", &data[i]);
+    return size;
+}
+
+static bool check(struct evmc_vm *vm, const struct Regression *regression, const char *engine, const char *analysis_mode)
+{
+    uint8_t code[256];
+    size_t code_size = unhex(regression->code, code);
+    uint8_t output[256];
+    size_t output_size = unhex(regression->output, output);
+
+    MockedHost host;
+    MockedHost_init(&host);
+    struct evmc_message msg;
+    EVMCMessage_init_v(&msg, regression->gas, NULL, 0);
+
+    vm->set_option(vm, "O", engine);
+    vm->set_option(vm, "analysis", analysis_mode);
+    struct evmc_result result = vm->execute(vm, (struct evmc_host_context *)&host, EVMC_LONDON, &msg, code, code_size);
+
+    int64_t gas_used = regression->gas - result.gas_left;
+    bool ok = result.status_code == regression->status && gas_used == regression->gas_used &&
+              result.output_size == output_size && memcmp(result.output_data, output, output_size) == 0;
+    if (!ok)
+        printf("FAIL %s O=%s analysis=%s: status %d, gas used %ld\n", regression->name, engine, analysis_mode,
+               result.status_code, (long)gas_used);
+    return ok;
+}
+
+int main()
+{
+    struct evmc_vm vm;
+    vm_init(&vm);
+    vm.set_option(&vm, "aot", "off");
+
+    int failures = 0;
+    for (size_t r = 0; r < sizeof(regressions) / sizeof(regressions[0]); ++r)
+        for (size_t e = 0; e < sizeof(engines) / sizeof(engines[0]); ++e)
+            for (size_t a = 0; a < sizeof(analysis_modes) / sizeof(analysis_modes[0]); ++a)
+                failures += !check(&vm, &regressions[r], engines[e], analysis_modes[a]);
+
+    printf("%d failures\n", failures);
+    return failures != 0;
+}
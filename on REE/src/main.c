@@ -41,6 +41,8 @@ int run(struct evmc_vm *vm, enum evmc_revision rev, int64_t gas, char *code_hex,
         gettimeofday(&end, NULL);
         long int bench_time = ((end.tv_sec - start.tv_sec) * 1000000 + end.tv_usec - start.tv_usec) / 1000;
         printf("Time: %ld us (avg of 1000 iterations)\n", bench_time);
+        printf("Analysis cache: %lu hits, %lu misses (%lu loaded), %lu evictions\n", (unsigned long)analysis_cache.hits,
+               (unsigned long)analysis_cache.misses, (unsigned long)analysis_cache.loads, (unsigned long)analysis_cache.evictions);
     }
 
     int64_t gas_used = msg->gas - result.gas_left;
@@ -103,15 +105,22 @@ int main(int argc, char *argv[])
     struct evmc_vm *vm = (struct evmc_vm *)malloc(sizeof(struct evmc_vm));
     vm_init(vm);
 
+    // Optional optimization level, e.g. "3" for the threaded dispatch.
+    if (argc > 1 && vm->set_option(vm, "O", argv[1]) != EVMC_SET_OPTION_SUCCESS)
+    {
+        printf("Invalid optimization level: %s\n", argv[1]);
+        return -1;
+    }
+
+    // Optional directory of the stored analyses, reused by the next runs.
+    if (argc > 2)
+        vm->set_option(vm, "analysis_store", argv[2]);
+
     enum evmc_revision rev = EVMC_LONDON;
 
     bool create = false;
     bool bench = true;
 
-    // Initialize instruction table
-    GasCostTable_init(gas_costs);
-    TraitsTable_init(traits);
-
     run(vm, rev, cjson_gas->valueint, cjson_bytecode->valuestring, cjson_input->valuestring, create, bench);
 
     // cJSON_Delete(cjson_content);
@@ -103,13 +103,20 @@ struct uint256_t Stack_pop(struct Stack *stack)
 /// Generic execution state for generic instructions implementations.
 struct AdvancedExecutionState
 {
-    struct ExecutionState estate;
-
-    /// The execution state specialized for the Advanced interpreter.
+    /// The execution state specialized for the Advanced interpreter, in the first cache line.
+    /// The ExecutionState starts the next one, its hot fields filling it, so the fields of
+    /// every block are two adjacent lines. The pool allocates the states 64-byte aligned.
     struct Stack stack;
     uint32_t current_block_cost;
+
+    _Alignas(64) struct ExecutionState estate;
 };
 
+_Static_assert(offsetof(struct AdvancedExecutionState, estate) % 64 == 0 &&
+                   offsetof(struct AdvancedExecutionState, estate.host) + sizeof(const struct HostInterface *) <=
+                       offsetof(struct AdvancedExecutionState, estate) + 64,
+               "the hot fields of ExecutionState must fill the cache line the ExecutionState starts");
+
 void AdvancedExecutionState_init(struct AdvancedExecutionState* state)
 {
     struct ExecutionState execution_state = state->estate;
@@ -131,24 +138,13 @@ void AdvancedExecutionState_init_v(struct AdvancedExecutionState* state, struct
     state->current_block_cost = 0;
 }
 
+/// Reinitializes the state of a finished execution for the next one. The memory keeps its
+/// capacity and the stack space is not cleared, the items are written before they are read.
 void AdvancedExecutionState_reset(struct AdvancedExecutionState* state, struct evmc_message* message, enum evmc_revision revision, struct evmc_host_context* host_ctx, uint8_t* code, size_t code_size)
 {
-    struct ExecutionState execution_state = state->estate;
-    execution_state.gas_left = message->gas;
-    Memory_clear(&execution_state.memory);
-    execution_state.msg = message;
-    
-    MockedHost_init(host_ctx);
-    execution_state.rev = revision;
-    execution_state.return_data = NULL;
-    execution_state.code.data = code;
-    execution_state.code.size = code_size;
-
-    execution_state.status = EVMC_SUCCESS;
-    execution_state.output_offset = 0;
-    execution_state.output_size = 0;
-    execution_state.analysis.advanced = NULL;
-    evmcContext_init(execution_state.m_tx);
+    ExecutionState_reset(&state->estate, message, revision, host_ctx, code, code_size);
+    Stack_init_v(&state->stack, StackSpace_bottom(&state->estate.stack_space));
+    state->current_block_cost = 0;
 }
 
 bool AdvancedExecutionState_in_static_mode(struct AdvancedExecutionState* state){
@@ -156,12 +152,9 @@ bool AdvancedExecutionState_in_static_mode(struct AdvancedExecutionState* state)
     return (execution_state.msg->flags & EVMC_STATIC != 0); 
 }
 
-struct evmc_tx_context AdvancedExecutionState_get_tx_context(struct AdvancedExecutionState* state)
+const struct evmc_tx_context *AdvancedExecutionState_get_tx_context(struct AdvancedExecutionState* state)
 {
-    struct ExecutionState execution_state = state->estate;
-    if(execution_state.m_tx.block_timestamp == 0)
-        execution_state.m_tx = get_tx_context(&execution_state.host_ctx);
-    return execution_state.m_tx;
+    return ExecutionState_get_tx_context(&state->estate);
 }
 
 /// The execution state specialized for the Advanced interpreter.
@@ -179,6 +172,31 @@ union InstructionArgument
     struct uint256_t *push_value;
     uint64_t small_push_value;
     struct BlockInfo block;
+
+    /// The operands of the fused DUP1 PUSH4 EQ PUSH2 JUMPI sequence.
+    /// The dest is the jump target as resolved by analyze(), see number below.
+    struct
+    {
+        uint32_t selector;
+        int32_t dest;
+    } selector_jump;
+
+    /// The hash table of a dispatcher, see opx_selector_dispatch(): the index of its first
+    /// slot in CodeAnalysis::selector_slots and the number of slots less one, a power of two
+    /// less one. The fall-through slot follows the table.
+    struct
+    {
+        uint32_t table;
+        uint32_t mask;
+    } selector_dispatch;
+
+    /// An edge inside a superblock, see opx_superblock_jump(): the base gas of the next block
+    /// and, for the static JUMPI, the resolved target of the side exit.
+    struct
+    {
+        int32_t dest;
+        uint32_t gas_cost;
+    } superblock_jump;
 };
 
 // static_assert(sizeof(union InstructionArgument) == sizeof(uint64_t), "Incorrect size of instruction_argument");
@@ -197,9 +215,28 @@ enum intrinsic_opcodes
     /// This instruction is defined as alias for JUMPDEST and replaces all JUMPDEST instructions.
     /// It is also injected at beginning of basic blocks not being the valid jump destination.
     /// It checks basic block execution requirements and terminates execution if they are not met.
-    OPX_BEGINBLOCK = OP_JUMPDEST
+    OPX_BEGINBLOCK = OP_JUMPDEST,
+
+    /// The superinstructions replacing common Solidity sequences, see fuse_instructions().
+    ///
+    /// They reuse values of opcodes undefined in all revisions. These only show up in the
+    /// CodeAnalysis::opcodes, where analyze() records the undefined instructions as OP_INVALID.
+    OPX_AND_ADDRESS = 0x0c,
+    OPX_PUSH_MLOAD = 0x0d,
+    OPX_ISZERO_ISZERO = 0x0e,
+    OPX_SELECTOR_JUMPI = 0x0f,
+    OPX_SELECTOR_DISPATCH = 0x22,
+
+    /// The instructions of the superblocks, see form_superblocks().
+    OPX_SUPERBLOCK = 0x23,
+    OPX_SUPERBLOCK_JUMPI = 0x24,
+    OPX_SUPERBLOCK_STATIC_JUMPI = 0x25,
+    OPX_SUPERBLOCK_JUMP = 0x26,
+    OPX_STATIC_JUMP = 0x1e,
+    OPX_STATIC_JUMPI = 0x1f
 };
 
+/// What analyze() needs to know about an instruction in a revision, see op_table_entry().
 struct OpTableEntry
 {
     instruction_exec_fn fn;
@@ -208,10 +245,6 @@ struct OpTableEntry
     int8_t stack_change;
 };
 
-typedef struct OpTable{
-    struct OpTableEntry table[256];
-}OpTable;
-
 struct Instruction
 {
     instruction_exec_fn fn;
@@ -259,467 +292,338 @@ int u256_cmp(const struct uint256_t* a, const struct uint256_t* b){
 #define i_tag int32
 #include "cvec.h"
 
-struct CodeAnalysis
-{
-    cvec_instr instrs;
-
-    cvec_u256 push_values;
-
-    /// The offsets of JUMPDESTs in the original code.
-    /// These are values that JUMP/JUMPI receives as an argument.
-    /// The elements are sorted.
-    cvec_int32 jumpdest_offsets;
-
-    /// The indexes of the instructions in the generated instruction table
-    /// matching the elements from jumdest_offsets.
-    /// This is value to which the next instruction pointer must be set in JUMP/JUMPI.
-    cvec_int32 jumpdest_targets;
-};
+#define i_val uint8_t
+#define i_tag uint8
+#include "cvec.h"
 
-void CodeAnalysis_init(struct CodeAnalysis *ca)
+/// The kinds of index find_jumpdest() uses to map a jump destination to an instruction.
+enum jumpdest_index_kind
 {
-    ca->instrs = cvec_instr_init();
-    ca->push_values = cvec_u256_init();
-    ca->jumpdest_offsets = cvec_int32_init();
-    ca->jumpdest_targets = cvec_int32_init();
-}
-
-int find_jumpdest(struct CodeAnalysis *analysis, int offset)
-{
-    cvec_int32_iter begin = cvec_int32_begin(&analysis->jumpdest_offsets);
-    cvec_int32_iter end = cvec_int32_end(&analysis->jumpdest_offsets);
-    cvec_int32_iter it = cvec_int32_lower_bound(&analysis->jumpdest_offsets, (int32_t)offset);
-    return (it.ref != end.ref && *it.ref == offset) ? *cvec_int32_at(&analysis->jumpdest_targets, (size_t)(it.ref - begin.ref)) : -1;
-}
-
-struct CodeAnalysis analyze(enum evmc_revision rev, uint8_t* code, size_t code_size);
-
-// OpTable get_op_table(enum evmc_revision rev); 
-
-/// Fake wrap for generic instruction implementations accessing current code location.
-/// This is to make any op<...> compile, but pointers must be replaced with Advanced-specific
-/// implementation. Definition not provided.
-struct Instruction* op_stop(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    return AdvancedExecutionState_exit(astate, stop().status);
-}
-
-struct Instruction* op_add(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    add(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_ADD)).stack_height_change;
-    return ++instr;
-}
+    /// Dense index for code up to JUMPDEST_DENSE_MAX_CODE_SIZE bytes, bitmap for larger code.
+    JUMPDEST_INDEX_AUTO,
 
-struct Instruction* op_mul(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    mul(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_MUL)).stack_height_change;
-    return ++instr;
-}
+    /// Binary search in jumpdest_offsets, no additional memory.
+    JUMPDEST_INDEX_SEARCH,
 
-struct Instruction* op_sub(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    sub(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_SUB)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_div(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    div_(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_DIV)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_sdiv(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    sdiv(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_SDIV)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_mod(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    mod(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_MOD)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_smod(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    smod(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_SMOD)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_addmod(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    addmod(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_ADDMOD)).stack_height_change;
-    return ++instr;
-}
+    /// A bit per code byte plus a JUMPDEST count per 64 code bytes, 0.19 bytes per code byte.
+    JUMPDEST_INDEX_BITMAP,
 
-struct Instruction* op_mulmod(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    mulmod(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_MULMOD)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_exp(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    enum evmc_status_code status = exp_(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_EXP)).stack_height_change;
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
-    return ++instr;
-}
-
-struct Instruction* op_signextend(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    signextend(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_SIGNEXTEND)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_lt(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    lt(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_LT)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_gt(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    gt(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_GT)).stack_height_change;
-    return ++instr;
-}
+    /// The instruction index for every code offset, 4 bytes per code byte.
+    JUMPDEST_INDEX_DENSE
+};
 
-struct Instruction* op_slt(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    slt(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_SLT)).stack_height_change;
-    return ++instr;
-}
+/// The code size up to which JUMPDEST_INDEX_AUTO builds the dense index.
+#define JUMPDEST_DENSE_MAX_CODE_SIZE 8192
 
-struct Instruction* op_sgt(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    sgt(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_SGT)).stack_height_change;
-    return ++instr;
-}
+/// The index analyze() builds, set with the "jumpdest_index" VM option.
+enum jumpdest_index_kind jumpdest_index_option = JUMPDEST_INDEX_AUTO;
 
-struct Instruction* op_eq(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    eq(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_EQ)).stack_height_change;
-    return ++instr;
-}
+/// How much of the code is analyzed before the execution.
+enum analysis_mode
+{
+    /// Lazy for code of LAZY_ANALYSIS_MIN_CODE_SIZE bytes and more, eager for smaller code.
+    ANALYSIS_AUTO,
 
-struct Instruction* op_iszero(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    iszero(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_ISZERO)).stack_height_change;
-    return ++instr;
-}
+    /// The whole code, with the optimizations needing all of it, see analyze().
+    ANALYSIS_EAGER,
 
-struct Instruction* op_and(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    and_(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_AND)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_or(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    or_(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_OR)).stack_height_change;
-    return ++instr;
-}
+    /// Only the code the executions reach, see analyze_lazy().
+    ANALYSIS_LAZY
+};
 
-struct Instruction* op_xor(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    xor_(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_XOR)).stack_height_change;
-    return ++instr;
-}
+/// The code size from which ANALYSIS_AUTO analyzes lazily.
+#define LAZY_ANALYSIS_MIN_CODE_SIZE 16384
 
-struct Instruction* op_not(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    not_(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_NOT)).stack_height_change;
-    return ++instr;
-}
+/// The analysis mode, set with the "analysis" VM option. The TA analyzes large code lazily
+/// by default, the eager analysis of a contract near the size limit takes a good part of the
+/// TA_DATA_SIZE heap.
+enum analysis_mode analysis_mode_option = ANALYSIS_AUTO;
 
-struct Instruction* op_byte(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    byte_(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_BYTE)).stack_height_change;
-    return ++instr;
-}
+/// The target of the jump destinations the lazy analysis has not reached yet.
+#define JUMPDEST_NOT_ANALYZED (-2)
 
-struct Instruction* op_shl(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    shl(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_SHL)).stack_height_change;
-    return ++instr;
-}
+/// The dest of the empty slots of a dispatcher hash table.
+#define SELECTOR_SLOT_EMPTY INT32_MIN
 
-struct Instruction* op_shr(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    shr(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_SHR)).stack_height_change;
-    return ++instr;
-}
+/// A slot of the hash table replacing a chain of OPX_SELECTOR_JUMPI, see opx_selector_dispatch().
+struct SelectorSlot
+{
+    uint32_t selector;
 
-struct Instruction* op_sar(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    sar(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_SAR)).stack_height_change;
-    return ++instr;
-}
+    /// The index of the instruction to continue with, -1 for an invalid jump destination.
+    int32_t dest;
 
-struct Instruction* op_keccak256(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    enum evmc_status_code status = keccak256(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_KECCAK256)).stack_height_change;
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
-    return ++instr;
-}
+    /// The base gas of the dispatcher blocks executed before reaching the entry.
+    int64_t gas;
+};
 
-struct Instruction* op_address(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    address(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_ADDRESS)).stack_height_change;
-    return ++instr;
-}
+/// A path of blocks along fall-through and static jump edges whose stack requirements are
+/// checked at once by the OPX_SUPERBLOCK replacing the BEGINBLOCK of its first block.
+struct Superblock
+{
+    /// The BlockInfo of the first block.
+    struct BlockInfo block;
 
-struct Instruction* op_balance(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    enum evmc_status_code status = balance(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_BALANCE)).stack_height_change;
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
-    return ++instr;
-}
+    /// The stack requirements of the whole path, relative to the stack height at its start.
+    int16_t stack_req;
+    int16_t stack_max_growth;
 
-struct Instruction* op_origin(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    origin(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_ORIGIN)).stack_height_change;
-    return ++instr;
-}
+    /// The index of the copy of the path in instrs without the BEGINBLOCKs of its blocks.
+    int32_t fast;
+};
 
-struct Instruction* op_caller(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    caller(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_CALLER)).stack_height_change;
-    return ++instr;
-}
+/// The analysis of the code. All the arrays are carved out of a single arena, so the analysis
+/// is allocated and freed in O(1), see CodeAnalysis_alloc().
+struct CodeAnalysis
+{
+    struct Instruction *instrs;
+    size_t instrs_size;
 
-struct Instruction* op_callvalue(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    callvalue(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_CALLVALUE)).stack_height_change;
-    return ++instr;
-}
+    /// The constant pool of the PUSH9-PUSH32 values, each distinct value stored once.
+    struct uint256_t *push_values;
+    size_t push_values_size;
 
-struct Instruction* op_calldataload(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    calldataload(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_CALLDATALOAD)).stack_height_change;
-    return ++instr;
-}
+    /// The hash tables of the OPX_SELECTOR_DISPATCH instructions.
+    struct SelectorSlot *selector_slots;
+    size_t selector_slots_size;
 
-struct Instruction* op_calldatasize(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    calldatasize(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_CALLDATASIZE)).stack_height_change;
-    return ++instr;
-}
+    /// The superblocks, indexed by the OPX_SUPERBLOCK instructions.
+    struct Superblock *superblocks;
+    size_t superblocks_size;
 
-struct Instruction* op_calldatacopy(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    enum evmc_status_code status = calldatacopy(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_CALLDATACOPY)).stack_height_change;
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
-    return ++instr;
-}
+    /// The offsets of JUMPDESTs in the original code.
+    /// These are values that JUMP/JUMPI receives as an argument.
+    /// The elements are sorted.
+    int32_t *jumpdest_offsets;
 
-struct Instruction* op_codesize(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    codesize(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_CODESIZE)).stack_height_change;
-    return ++instr;
-}
+    /// The indexes of the instructions in the generated instruction table
+    /// matching the elements from jumdest_offsets.
+    /// This is value to which the next instruction pointer must be set in JUMP/JUMPI.
+    int32_t *jumpdest_targets;
+    size_t jumpdests_size;
 
-struct Instruction* op_codecopy(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    enum evmc_status_code status = codecopy(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_CODECOPY)).stack_height_change;
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
-    return ++instr;
-}
+    /// The opcodes of the instructions in instrs, OPX_BEGINBLOCK for the injected blocks.
+    /// This is what the threaded dispatch in execute_analyzed_code_threaded() indexes.
+    uint8_t *opcodes;
 
-struct Instruction* op_gasprice(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    gasprice(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_GASPRICE)).stack_height_change;
-    return ++instr;
-}
+    /// The index find_jumpdest() uses, never JUMPDEST_INDEX_AUTO.
+    enum jumpdest_index_kind jumpdest_index;
 
-struct Instruction* op_extcodesize(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    enum evmc_status_code status = extcodesize(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_EXTCODESIZE)).stack_height_change;
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
-    return ++instr;
-}
+    /// The code size, destinations at or above it are never valid.
+    int code_size;
 
-struct Instruction* op_extcodecopy(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    enum evmc_status_code status = extcodecopy(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_EXTCODECOPY)).stack_height_change;
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
-    return ++instr;
-}
+    /// JUMPDEST_INDEX_DENSE: the instruction index for every code offset, -1 if not a JUMPDEST.
+    int32_t *jumpdest_map;
+    size_t jumpdest_map_size;
 
-struct Instruction* op_returndatasize(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    returndatasize(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_RETURNDATASIZE)).stack_height_change;
-    return ++instr;
-}
+    /// JUMPDEST_INDEX_BITMAP: the bit set for every JUMPDEST offset, and for every 64-bit
+    /// word of the bitmap the number of JUMPDESTs before it, i.e. the index of its first
+    /// JUMPDEST in jumpdest_targets.
+    uint64_t *jumpdest_bitmap;
+    int32_t *jumpdest_rank;
+    size_t jumpdest_bitmap_size;
 
-struct Instruction* op_returndatacopy(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    enum evmc_status_code status = returndatacopy(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_RETURNDATACOPY)).stack_height_change;
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
-    return ++instr;
-}
+    void *arena;
+    size_t arena_size;
 
-struct Instruction* op_extcodehash(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    enum evmc_status_code status = extcodehash(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_EXTCODEHASH)).stack_height_change;
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
-    return ++instr;
-}
+    /// The storage of instrs, opcodes and push_values if the analysis is lazy, see
+    /// analyze_lazy(), otherwise NULL. The arena then holds the jump destination index only.
+    struct AnalysisScratch *lazy;
+};
 
-struct Instruction* op_blockhash(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    blockhash(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_BLOCKHASH)).stack_height_change;
-    return ++instr;
-}
+void AnalysisScratch_free(struct AnalysisScratch *scratch);
+size_t AnalysisScratch_size(struct AnalysisScratch *scratch);
 
-struct Instruction* op_coinbase(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    coinbase(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_COINBASE)).stack_height_change;
-    return ++instr;
+/// Allocates the arena of the analysis and points the arrays into it, ordered by alignment.
+/// The jump destination index arrays are sized for the jumpdest_index and code_size.
+void CodeAnalysis_alloc(struct CodeAnalysis *ca, size_t instrs_size, size_t push_values_size, size_t selector_slots_size,
+                        size_t superblocks_size, size_t jumpdests_size)
+{
+    ca->instrs_size = instrs_size;
+    ca->push_values_size = push_values_size;
+    ca->selector_slots_size = selector_slots_size;
+    ca->superblocks_size = superblocks_size;
+    ca->jumpdests_size = jumpdests_size;
+    ca->jumpdest_map_size = ca->jumpdest_index == JUMPDEST_INDEX_DENSE ? (size_t)ca->code_size : 0;
+    ca->jumpdest_bitmap_size = ca->jumpdest_index == JUMPDEST_INDEX_BITMAP ? ((size_t)ca->code_size + 63) / 64 : 0;
+
+    ca->lazy = NULL;
+    ca->arena_size = push_values_size * sizeof(struct uint256_t) +
+                     selector_slots_size * sizeof(struct SelectorSlot) +
+                     instrs_size * sizeof(struct Instruction) +
+                     ca->jumpdest_bitmap_size * sizeof(uint64_t) +
+                     superblocks_size * sizeof(struct Superblock) +
+                     jumpdests_size * 2 * sizeof(int32_t) +
+                     ca->jumpdest_map_size * sizeof(int32_t) +
+                     ca->jumpdest_bitmap_size * sizeof(int32_t) +
+                     instrs_size * sizeof(uint8_t);
+    uint8_t *pos = (uint8_t *)TEE_Malloc(ca->arena_size, TEE_MALLOC_FILL_ZERO);
+    ca->arena = pos;
+
+    ca->push_values = (struct uint256_t *)pos;
+    pos += push_values_size * sizeof(struct uint256_t);
+    ca->selector_slots = (struct SelectorSlot *)pos;
+    pos += selector_slots_size * sizeof(struct SelectorSlot);
+    ca->instrs = (struct Instruction *)pos;
+    pos += instrs_size * sizeof(struct Instruction);
+    ca->jumpdest_bitmap = (uint64_t *)pos;
+    pos += ca->jumpdest_bitmap_size * sizeof(uint64_t);
+    ca->superblocks = (struct Superblock *)pos;
+    pos += superblocks_size * sizeof(struct Superblock);
+    ca->jumpdest_offsets = (int32_t *)pos;
+    pos += jumpdests_size * sizeof(int32_t);
+    ca->jumpdest_targets = (int32_t *)pos;
+    pos += jumpdests_size * sizeof(int32_t);
+    ca->jumpdest_map = (int32_t *)pos;
+    pos += ca->jumpdest_map_size * sizeof(int32_t);
+    ca->jumpdest_rank = (int32_t *)pos;
+    pos += ca->jumpdest_bitmap_size * sizeof(int32_t);
+    ca->opcodes = pos;
+}
+
+/// Releases the storage of the analysis.
+void CodeAnalysis_free(struct CodeAnalysis *ca)
+{
+    TEE_Free(ca->arena);
+    ca->arena = NULL;
+    if (ca->lazy != NULL)
+    {
+        AnalysisScratch_free(ca->lazy);
+        ca->lazy = NULL;
+    }
 }
 
-struct Instruction* op_timestamp(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    timestamp(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_TIMESTAMP)).stack_height_change;
-    return ++instr;
+/// The number of bytes allocated for the analysis. A lazy analysis grows while executed.
+size_t CodeAnalysis_size(struct CodeAnalysis *ca)
+{
+    size_t size = sizeof(struct CodeAnalysis) + ca->arena_size;
+    if (ca->lazy != NULL)
+        size += AnalysisScratch_size(ca->lazy);
+    return size;
 }
 
-struct Instruction* op_number(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    number(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_NUMBER)).stack_height_change;
-    return ++instr;
+/// Returns the position of the offset in jumpdest_offsets, jumpdests_size if not a JUMPDEST.
+size_t jumpdest_position(const struct CodeAnalysis *analysis, int offset)
+{
+    size_t low = 0;
+    size_t high = analysis->jumpdests_size;
+    while (low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if (analysis->jumpdest_offsets[middle] < offset)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return (low != analysis->jumpdests_size && analysis->jumpdest_offsets[low] == offset) ? low : analysis->jumpdests_size;
 }
 
-struct Instruction* op_difficulty(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    difficulty(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_DIFFICULTY)).stack_height_change;
-    return ++instr;
-}
+int find_jumpdest(struct CodeAnalysis *analysis, int offset)
+{
+    if (offset < 0 || offset >= analysis->code_size)
+        return -1;
 
-struct Instruction* op_gaslimit(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    gaslimit(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_GASLIMIT)).stack_height_change;
-    return ++instr;
-}
+    if (analysis->jumpdest_index == JUMPDEST_INDEX_DENSE)
+        return analysis->jumpdest_map[offset];
 
-struct Instruction* op_chainid(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    chainid(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_CHAINID)).stack_height_change;
-    return ++instr;
-}
+    if (analysis->jumpdest_index == JUMPDEST_INDEX_BITMAP)
+    {
+        uint64_t word = analysis->jumpdest_bitmap[offset / 64];
+        uint64_t bit = (uint64_t)1 << (offset % 64);
+        if ((word & bit) == 0)
+            return -1;
+        int rank = analysis->jumpdest_rank[offset / 64] + __builtin_popcountll(word & (bit - 1));
+        return analysis->jumpdest_targets[rank];
+    }
 
-struct Instruction* op_selfbalance(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    selfbalance(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_SELFBALANCE)).stack_height_change;
-    return ++instr;
+    size_t position = jumpdest_position(analysis, offset);
+    return position != analysis->jumpdests_size ? analysis->jumpdest_targets[position] : -1;
 }
 
-struct Instruction* op_basefee(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    basefee(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_BASEFEE)).stack_height_change;
-    return ++instr;
-}
+struct CodeAnalysis analyze(enum evmc_revision rev, uint8_t* code, size_t code_size);
+int analyze_lazy_from(struct CodeAnalysis *analysis, enum evmc_revision rev, uint8_t *code, size_t code_size, size_t offset);
 
-struct Instruction* op_pop(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    pop(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_POP)).stack_height_change;
-    return ++instr;
+/// Returns the instruction index of the jump destination of the execution as find_jumpdest().
+/// The lazy analysis is extended from the destination first if not reached before, which
+/// may move the instructions.
+int resolve_jumpdest(struct ExecutionState *state, int offset)
+{
+    struct CodeAnalysis *analysis = state->analysis.advanced;
+    int pc = find_jumpdest(analysis, offset);
+    if (pc == JUMPDEST_NOT_ANALYZED)
+        pc = analyze_lazy_from(analysis, state->rev, state->code.data, state->code.size, (size_t)offset);
+    return pc;
 }
 
-struct Instruction* op_mload(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    enum evmc_status_code status = mload(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_MLOAD)).stack_height_change;
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
-    return ++instr;
+/// Fake wrap for generic instruction implementations accessing current code location.
+/// This is to make any op<...> compile, but pointers must be replaced with Advanced-specific
+/// implementation. Definition not provided.
+struct Instruction* op_stop(struct Instruction* instr, struct AdvancedExecutionState* astate){
+    return AdvancedExecutionState_exit(astate, stop().status);
 }
 
-struct Instruction* op_mstore(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    enum evmc_status_code status = mstore(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_MSTORE)).stack_height_change;
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
-    return ++instr;
-}
+/// Generators of the op_* handlers for the instruction kinds of instructions_xmacro.h.
+/// The stack height change is a literal from the table, not a load from traits.
 
-struct Instruction* op_mstore8(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    enum evmc_status_code status = mstore8(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_MSTORE8)).stack_height_change;
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
-    return ++instr;
-}
+/// Instructions operating on the stack only.
+#define INSTRUCTION_STACK(identifier, impl, change) \
+    struct Instruction* op_##identifier(struct Instruction* instr, struct AdvancedExecutionState* astate){ \
+        impl(makeStackTop(astate->stack.top_item)); \
+        astate->stack.top_item += (change); \
+        return ++instr; \
+    }
 
-struct Instruction* op_sload(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    enum evmc_status_code status = sload(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_SLOAD)).stack_height_change;
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
-    return ++instr;
-}
+/// Instructions also accessing the execution state.
+#define INSTRUCTION_STATE(identifier, impl, change) \
+    struct Instruction* op_##identifier(struct Instruction* instr, struct AdvancedExecutionState* astate){ \
+        struct ExecutionState* state = &astate->estate; \
+        impl(makeStackTop(astate->stack.top_item), state); \
+        astate->stack.top_item += (change); \
+        return ++instr; \
+    }
 
-struct Instruction* op_sstore(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    int64_t gas_left_correction = (int64_t)astate->current_block_cost - (int64_t)instr->arg.number;
-    state->gas_left += gas_left_correction;
+/// Instructions which may terminate the execution with an error status.
+#define INSTRUCTION_STATUS(identifier, impl, change) \
+    struct Instruction* op_##identifier(struct Instruction* instr, struct AdvancedExecutionState* astate){ \
+        struct ExecutionState* state = &astate->estate; \
+        enum evmc_status_code status = impl(makeStackTop(astate->stack.top_item), state); \
+        astate->stack.top_item += (change); \
+        if(status != EVMC_SUCCESS) \
+            return AdvancedExecutionState_exit(astate, status); \
+        return ++instr; \
+    }
 
-    enum evmc_status_code status = sstore(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_SSTORE)).stack_height_change;
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
+/// Instructions which need the exact gas left: the part of the block cost not yet spent
+/// is given back before the instruction and charged again after it.
+#define INSTRUCTION_GAS_CORRECTION(identifier, impl, change) \
+    struct Instruction* op_##identifier(struct Instruction* instr, struct AdvancedExecutionState* astate){ \
+        struct ExecutionState* state = &astate->estate; \
+        int64_t gas_left_correction = (int64_t)astate->current_block_cost - (int64_t)instr->arg.number; \
+        state->gas_left += gas_left_correction; \
+        enum evmc_status_code status = impl(makeStackTop(astate->stack.top_item), state); \
+        astate->stack.top_item += (change); \
+        if(status != EVMC_SUCCESS) \
+            return AdvancedExecutionState_exit(astate, status); \
+        if((state->gas_left -= gas_left_correction) < 0) \
+            return AdvancedExecutionState_exit(astate, EVMC_OUT_OF_GAS); \
+        return ++instr; \
+    }
 
-    if((state->gas_left -= gas_left_correction) < 0)
-        return AdvancedExecutionState_exit(astate, EVMC_OUT_OF_GAS);
+/// The handlers below are written by hand.
+#define INSTRUCTION_CUSTOM(identifier, impl, change)
 
-    return ++instr;
-}
+#define X(opcode, identifier, impl, kind, required, change, since) INSTRUCTION_##kind(identifier, impl, change)
+MAP_OPCODE_TO_IDENTIFIER
+#undef X
 
 struct Instruction* op_jump(struct Instruction* instr, struct AdvancedExecutionState* astate){
     struct ExecutionState* state = &astate->estate;
     struct uint256_t dst = Stack_pop(&astate->stack);
     int pc = -1;
     int dst_ = (int)LOWER(LOWER(dst));
-    if( dst_ > INT_MAX || (pc = find_jumpdest(state->analysis.advanced, dst_)) < 0)
+    if( dst_ > INT_MAX || (pc = resolve_jumpdest(state, dst_)) < 0)
         return AdvancedExecutionState_exit(astate, EVMC_BAD_JUMP_DESTINATION);
-    return cvec_instr_at_mut(&state->analysis.advanced->instrs, pc);
+    return &state->analysis.advanced->instrs[pc];
 }
 
 struct Instruction* op_jumpi(struct Instruction* instr, struct AdvancedExecutionState* astate){
@@ -745,13 +649,6 @@ struct Instruction* op_pc(struct Instruction* instr, struct AdvancedExecutionSta
     return ++instr;
 }
 
-struct Instruction* op_msize(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    msize(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_MSIZE)).stack_height_change;
-    return ++instr;
-}
-
 struct Instruction* op_gas(struct Instruction* instr, struct AdvancedExecutionState* astate){
     struct ExecutionState* state = &astate->estate;
     uint64_t correction = (uint64_t) astate->current_block_cost - (uint64_t)instr->arg.number;
@@ -761,19 +658,6 @@ struct Instruction* op_gas(struct Instruction* instr, struct AdvancedExecutionSt
     return ++instr;
 }
 
-struct Instruction* op_jumpdest(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    jumpdest(makeStackTop(astate->stack.top_item));
-    astate->stack.top_item += (*(traits + OP_JUMPDEST)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_push0(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    push0(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_PUSH0)).stack_height_change;
-    return ++instr;
-}
-
 struct Instruction* op_push_small(struct Instruction* instr, struct AdvancedExecutionState* astate){
     struct uint256_t tmp = (struct uint256_t){0, 0, 0, instr->arg.small_push_value};
     Stack_push(&astate->stack, &tmp);
@@ -785,398 +669,171 @@ struct Instruction* op_push_full(struct Instruction* instr, struct AdvancedExecu
     return ++instr;
 }
 
-struct Instruction* op_dup1(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    dup1(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_DUP1)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_dup2(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    dup2(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_DUP2)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_dup3(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    dup3(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_DUP3)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_dup4(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    dup4(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_DUP4)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_dup5(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    dup5(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_DUP5)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_dup6(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    dup6(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_DUP6)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_dup7(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    dup7(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_DUP7)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_dup8(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    dup8(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_DUP8)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_dup9(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    dup9(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_DUP9)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_dup10(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    dup10(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_DUP10)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_dup11(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    dup11(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_DUP11)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_dup12(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    dup12(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_DUP12)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_dup13(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    dup13(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_DUP13)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_dup14(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    dup14(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_DUP14)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_dup15(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    dup15(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_DUP15)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_dup16(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    dup16(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_DUP16)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_swap1(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    swap1(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_SWAP1)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_swap2(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    swap2(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_SWAP2)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_swap3(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    swap3(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_SWAP3)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_swap4(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    swap4(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_SWAP4)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_swap5(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    swap5(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_SWAP5)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_swap6(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    swap6(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_SWAP6)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_swap7(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    swap7(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_SWAP7)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_swap8(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    swap8(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_SWAP8)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_swap9(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    swap9(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_SWAP9)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_swap10(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    swap10(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_SWAP10)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_swap11(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    swap11(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_SWAP11)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_swap12(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    swap12(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_SWAP12)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_swap13(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    swap13(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_SWAP13)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_swap14(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    swap14(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_SWAP14)).stack_height_change;
-    return ++instr;
-}
-
-struct Instruction* op_swap15(struct Instruction* instr, struct AdvancedExecutionState* astate){
+struct Instruction* op_return(struct Instruction* instr, struct AdvancedExecutionState* astate){
     struct ExecutionState* state = &astate->estate;
-    swap15(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_SWAP15)).stack_height_change;
-    return ++instr;
+    return AdvancedExecutionState_exit(astate, return_(makeStackTop(astate->stack.top_item), state).status);
 }
 
-struct Instruction* op_swap16(struct Instruction* instr, struct AdvancedExecutionState* astate){
+struct Instruction* op_revert(struct Instruction* instr, struct AdvancedExecutionState* astate){
     struct ExecutionState* state = &astate->estate;
-    swap16(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_SWAP16)).stack_height_change;
-    return ++instr;
+    return AdvancedExecutionState_exit(astate, revert(makeStackTop(astate->stack.top_item), state).status);
 }
 
-struct Instruction* op_log0(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    enum evmc_status_code status = log0(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_LOG0)).stack_height_change;
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
-    return ++instr;
+struct Instruction* op_invalid(struct Instruction* instr, struct AdvancedExecutionState* astate){
+    return AdvancedExecutionState_exit(astate, invalid().status);
 }
 
-struct Instruction* op_log1(struct Instruction* instr, struct AdvancedExecutionState* astate){
+struct Instruction* op_selfdestruct(struct Instruction* instr, struct AdvancedExecutionState* astate){
     struct ExecutionState* state = &astate->estate;
-    enum evmc_status_code status = log1(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_LOG1)).stack_height_change;
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
-    return ++instr;
+    return AdvancedExecutionState_exit(astate, selfdestruct_(makeStackTop(astate->stack.top_item), state).status);
 }
 
-struct Instruction* op_log2(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    enum evmc_status_code status = log2_(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_LOG2)).stack_height_change;
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
-    return ++instr;
+struct Instruction* op_undefined(struct Instruction* instr, struct AdvancedExecutionState* astate){
+    return AdvancedExecutionState_exit(astate, EVMC_UNDEFINED_INSTRUCTION);
 }
 
-struct Instruction* op_log3(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    enum evmc_status_code status = log3(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_LOG3)).stack_height_change;
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
+/// PUSH20 0xff..ff AND: truncates the top item to an address.
+struct Instruction* opx_and_address(struct Instruction* instr, struct AdvancedExecutionState* astate){
+    struct uint256_t *x = astate->stack.top_item;
+    WORD_P(x, 3) = 0;
+    WORD_P(x, 2) &= 0xffffffff;
     return ++instr;
 }
 
-struct Instruction* op_log4(struct Instruction* instr, struct AdvancedExecutionState* astate){
+/// PUSH1 x MLOAD: loads the word at a constant offset, e.g. the free memory pointer.
+struct Instruction* opx_push_mload(struct Instruction* instr, struct AdvancedExecutionState* astate){
     struct ExecutionState* state = &astate->estate;
-    enum evmc_status_code status = log4(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_LOG4)).stack_height_change;
+    *++astate->stack.top_item = (struct uint256_t){0, 0, 0, instr->arg.small_push_value};
+    enum evmc_status_code status = mload(makeStackTop(astate->stack.top_item), state);
     if(status != EVMC_SUCCESS)
         return AdvancedExecutionState_exit(astate, status);
     return ++instr;
 }
 
-struct Instruction* op_create(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    int64_t gas_left_correction = (int64_t)astate->current_block_cost - (int64_t)instr->arg.number;
-    state->gas_left += gas_left_correction;
-
-    enum evmc_status_code status = create(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_CREATE)).stack_height_change;
-
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
-    
-    if((state->gas_left -= gas_left_correction) < 0)
-        return AdvancedExecutionState_exit(astate, EVMC_OUT_OF_GAS);
-
+/// ISZERO ISZERO: converts the top item to a bool.
+struct Instruction* opx_iszero_iszero(struct Instruction* instr, struct AdvancedExecutionState* astate){
+    struct uint256_t *x = astate->stack.top_item;
+    *x = (struct uint256_t){0, 0, 0, !zero256(x)};
     return ++instr;
 }
 
-struct Instruction* op_call(struct Instruction* instr, struct AdvancedExecutionState* astate){
+/// DUP1 PUSH4 selector EQ PUSH2 dest JUMPI: one entry of the Solidity function dispatcher.
+/// The top item is compared in place, the stack is left unchanged on both paths.
+struct Instruction* opx_selector_jumpi(struct Instruction* instr, struct AdvancedExecutionState* astate){
     struct ExecutionState* state = &astate->estate;
-    int64_t gas_left_correction = (int64_t)astate->current_block_cost - (int64_t)instr->arg.number;
-    state->gas_left += gas_left_correction;
-
-    enum evmc_status_code status = call_(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_CALL)).stack_height_change;
-
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
-    
-    if((state->gas_left -= gas_left_correction) < 0)
-        return AdvancedExecutionState_exit(astate, EVMC_OUT_OF_GAS);
-
-    return ++instr;
+    struct uint256_t *x = astate->stack.top_item;
+    if(WORD_P(x, 3) != 0 || WORD_P(x, 2) != 0 || WORD_P(x, 1) != 0 || WORD_P(x, 0) != instr->arg.selector_jump.selector)
+        return ++instr;
+    if(instr->arg.selector_jump.dest < 0)
+        return AdvancedExecutionState_exit(astate, EVMC_BAD_JUMP_DESTINATION);
+    return &state->analysis.advanced->instrs[instr->arg.selector_jump.dest];
+}
+
+/// Returns the slot of the dispatcher for the selector x, the fall-through slot if x is not one
+/// of the selectors of the chain.
+const struct SelectorSlot *selector_dispatch_find(const struct CodeAnalysis *analysis, union InstructionArgument arg, const struct uint256_t *x){
+    const struct SelectorSlot *table = analysis->selector_slots + arg.selector_dispatch.table;
+    uint32_t mask = arg.selector_dispatch.mask;
+    if(WORD_P(x, 3) != 0 || WORD_P(x, 2) != 0 || WORD_P(x, 1) != 0 || WORD_P(x, 0) > UINT32_MAX)
+        return &table[mask + 1];
+    uint32_t selector = (uint32_t)WORD_P(x, 0);
+    // The selectors are prefixes of Keccak hashes, their low bits are as good as any hash.
+    for(uint32_t i = selector & mask; table[i].dest != SELECTOR_SLOT_EMPTY; i = (i + 1) & mask)
+        if(table[i].selector == selector)
+            return &table[i];
+    return &table[mask + 1];
+}
+
+/// A chain of OPX_SELECTOR_JUMPI, one per block: the whole Solidity function dispatcher.
+/// It replaces the first entry of the chain, see build_selector_dispatch(), and jumps to the
+/// matching entry's destination in a single lookup instead of comparing the selectors one
+/// by one. The gas of the skipped dispatcher blocks is charged at once, their stack checks
+/// cannot fail as the stack is the same at the start of every one of them. If the gas does
+/// not cover the skipped blocks the chain is walked as before, so the execution runs out of
+/// gas at exactly the same block.
+struct Instruction* opx_selector_dispatch(struct Instruction* instr, struct AdvancedExecutionState* astate){
+    struct ExecutionState* state = &astate->estate;
+    const struct SelectorSlot *slot = selector_dispatch_find(state->analysis.advanced, instr->arg, astate->stack.top_item);
+    if(slot->gas > state->gas_left)
+        return ++instr;
+    state->gas_left -= slot->gas;
+    if(slot->dest < 0)
+        return AdvancedExecutionState_exit(astate, EVMC_BAD_JUMP_DESTINATION);
+    return &state->analysis.advanced->instrs[slot->dest];
 }
 
-struct Instruction* op_callcode(struct Instruction* instr, struct AdvancedExecutionState* astate){
+/// PUSH dest JUMP with dest resolved by analyze(): the argument is the index of the target
+/// instruction, or -1 if dest is not a valid jump destination.
+struct Instruction* opx_static_jump(struct Instruction* instr, struct AdvancedExecutionState* astate){
     struct ExecutionState* state = &astate->estate;
-    int64_t gas_left_correction = (int64_t)astate->current_block_cost - (int64_t)instr->arg.number;
-    state->gas_left += gas_left_correction;
-
-    enum evmc_status_code status = callcode(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_CALLCODE)).stack_height_change;
-
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
-    
-    if((state->gas_left -= gas_left_correction) < 0)
-        return AdvancedExecutionState_exit(astate, EVMC_OUT_OF_GAS);
-
-    return ++instr;
+    if(instr->arg.number < 0)
+        return AdvancedExecutionState_exit(astate, EVMC_BAD_JUMP_DESTINATION);
+    return &state->analysis.advanced->instrs[instr->arg.number];
 }
 
-struct Instruction* op_return(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    return AdvancedExecutionState_exit(astate, return_(makeStackTop(astate->stack.top_item), state).status);
+/// PUSH dest JUMPI with dest resolved by analyze(), as for opx_static_jump().
+struct Instruction* opx_static_jumpi(struct Instruction* instr, struct AdvancedExecutionState* astate){
+    struct uint256_t cond = Stack_pop(&astate->stack);
+    if(zero256(&cond))
+        return ++instr;
+    return opx_static_jump(instr, astate);
 }
 
-struct Instruction* op_delegatecall(struct Instruction* instr, struct AdvancedExecutionState* astate){
+/// The BEGINBLOCK of the first block of a superblock. If the stack is within the requirements
+/// of the whole path, the execution continues in the copy of the path without the BEGINBLOCKs
+/// of the other blocks, otherwise in the original code, checking every block on its own.
+/// The gas is still charged block by block, see opx_superblock_jump(), as the dynamic costs
+/// of a block can leave too little for the next one.
+struct Instruction* opx_superblock(struct Instruction* instr, struct AdvancedExecutionState* astate){
     struct ExecutionState* state = &astate->estate;
-    int64_t gas_left_correction = (int64_t)astate->current_block_cost - (int64_t)instr->arg.number;
-    state->gas_left += gas_left_correction;
-
-    enum evmc_status_code status = delegatecall(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_DELEGATECALL)).stack_height_change;
+    const struct Superblock *superblock = &state->analysis.advanced->superblocks[instr->arg.number];
+    struct BlockInfo block = superblock->block;
 
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
-    
-    if((state->gas_left -= gas_left_correction) < 0)
+    if((state->gas_left -= (int64_t)block.gas_cost) < 0)
         return AdvancedExecutionState_exit(astate, EVMC_OUT_OF_GAS);
+    astate->current_block_cost = (uint32_t)block.gas_cost;
 
-    return ++instr;
-}
-
-struct Instruction* op_create2(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    int64_t gas_left_correction = (int64_t)astate->current_block_cost - (int64_t)instr->arg.number;
-    state->gas_left += gas_left_correction;
-
-    enum evmc_status_code status = create2(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_CREATE2)).stack_height_change;
-
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
-    
-    if((state->gas_left -= gas_left_correction) < 0)
-        return AdvancedExecutionState_exit(astate, EVMC_OUT_OF_GAS);
+    int stack_size = Stack_size(&astate->stack);
+    if(stack_size >= superblock->stack_req && stack_size + superblock->stack_max_growth <= 1024)
+        return &state->analysis.advanced->instrs[superblock->fast];
 
+    if(stack_size < block.stack_req)
+        return AdvancedExecutionState_exit(astate, EVMC_STACK_UNDERFLOW);
+    if(stack_size + block.stack_max_growth > 1024)
+        return AdvancedExecutionState_exit(astate, EVMC_STACK_OVERFLOW);
     return ++instr;
 }
 
-struct Instruction* op_staticcall(struct Instruction* instr, struct AdvancedExecutionState* astate){
+/// A static JUMP inside a superblock, continuing with the copy of the target block: the
+/// BEGINBLOCK of the target without the stack checks done by opx_superblock().
+struct Instruction* opx_superblock_jump(struct Instruction* instr, struct AdvancedExecutionState* astate){
     struct ExecutionState* state = &astate->estate;
-    int64_t gas_left_correction = (int64_t)astate->current_block_cost - (int64_t)instr->arg.number;
-    state->gas_left += gas_left_correction;
-
-    enum evmc_status_code status = staticcall(makeStackTop(astate->stack.top_item), state);
-    astate->stack.top_item += (*(traits + OP_STATICCALL)).stack_height_change;
-
-    if(status != EVMC_SUCCESS)
-        return AdvancedExecutionState_exit(astate, status);
-    
-    if((state->gas_left -= gas_left_correction) < 0)
+    uint32_t gas_cost = instr->arg.superblock_jump.gas_cost;
+    if((state->gas_left -= (int64_t)gas_cost) < 0)
         return AdvancedExecutionState_exit(astate, EVMC_OUT_OF_GAS);
-
+    astate->current_block_cost = gas_cost;
     return ++instr;
 }
 
-struct Instruction* op_revert(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    struct ExecutionState* state = &astate->estate;
-    return AdvancedExecutionState_exit(astate, revert(makeStackTop(astate->stack.top_item), state).status);
-}
-
-struct Instruction* op_invalid(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    return AdvancedExecutionState_exit(astate, invalid().status);
+/// A JUMPI inside a superblock: the jump leaves the superblock, otherwise the execution
+/// continues with the next block as for opx_superblock_jump().
+struct Instruction* opx_superblock_jumpi(struct Instruction* instr, struct AdvancedExecutionState* astate){
+    struct uint256_t cond = Stack_get(&astate->stack, 1);
+    if(!zero256(&cond))
+        return op_jumpi(instr, astate);
+    astate->stack.top_item -= 2;
+    return opx_superblock_jump(instr, astate);
 }
 
-struct Instruction* op_selfdestruct(struct Instruction* instr, struct AdvancedExecutionState* astate){
+/// A static JUMPI inside a superblock, as for opx_superblock_jumpi().
+struct Instruction* opx_superblock_static_jumpi(struct Instruction* instr, struct AdvancedExecutionState* astate){
     struct ExecutionState* state = &astate->estate;
-    return AdvancedExecutionState_exit(astate, selfdestruct_(makeStackTop(astate->stack.top_item), state).status);
-}
-
-struct Instruction* op_undefined(struct Instruction* instr, struct AdvancedExecutionState* astate){
-    return AdvancedExecutionState_exit(astate, EVMC_UNDEFINED_INSTRUCTION);
+    struct uint256_t cond = Stack_pop(&astate->stack);
+    if(zero256(&cond))
+        return opx_superblock_jump(instr, astate);
+    if(instr->arg.superblock_jump.dest < 0)
+        return AdvancedExecutionState_exit(astate, EVMC_BAD_JUMP_DESTINATION);
+    return &state->analysis.advanced->instrs[instr->arg.superblock_jump.dest];
 }
 
 struct Instruction* opx_beginblock(struct Instruction* instr, struct AdvancedExecutionState* astate){
@@ -1196,186 +853,31 @@ struct Instruction* opx_beginblock(struct Instruction* instr, struct AdvancedExe
     return ++instr;
 }
 
-struct InstructionFnTable{
-    instruction_exec_fn table[256];
+/// The handlers of the instructions, built at compile time like gas_costs and traits.
+/// Whether an instruction is defined in a revision is up to gas_costs, see instruction_fn().
+static const instruction_exec_fn instruction_fns[256] = {
+    [0 ... 255] = op_undefined,
+#define X(opcode, identifier, impl, kind, required, change, since) [opcode] = op_##identifier,
+    MAP_OPCODE_TO_IDENTIFIER
+#undef X
+    [OPX_BEGINBLOCK] = opx_beginblock,
 };
 
-void InstructionFnTable_init(struct InstructionFnTable* instrfns){
-    instrfns->table[OP_STOP] = op_stop;
-    instrfns->table[OP_ADD] = op_add;
-    instrfns->table[OP_MUL] = op_mul;
-    instrfns->table[OP_SUB] = op_sub;
-    instrfns->table[OP_DIV] = op_div;
-    instrfns->table[OP_SDIV] = op_sdiv;
-    instrfns->table[OP_MOD] = op_mod;
-    instrfns->table[OP_SMOD] = op_smod;
-    instrfns->table[OP_ADDMOD] = op_addmod;
-    instrfns->table[OP_MULMOD] = op_mulmod;
-    instrfns->table[OP_EXP] = op_exp;
-    instrfns->table[OP_SIGNEXTEND] = op_signextend;
-
-    instrfns->table[OP_LT] = op_lt;
-    instrfns->table[OP_GT] = op_gt;
-    instrfns->table[OP_SLT] = op_slt;
-    instrfns->table[OP_SGT] = op_sgt;
-    instrfns->table[OP_EQ] = op_eq;
-    instrfns->table[OP_ISZERO] = op_iszero;
-    instrfns->table[OP_AND] = op_and;
-    instrfns->table[OP_OR] = op_or;
-    instrfns->table[OP_XOR] = op_xor;
-    instrfns->table[OP_NOT] = op_not;
-    instrfns->table[OP_BYTE] = op_byte;
-    instrfns->table[OP_SHL] = op_shl;
-    instrfns->table[OP_SHR] = op_shr;
-    instrfns->table[OP_SAR] = op_sar;
-
-    instrfns->table[OP_KECCAK256] = op_keccak256;
-
-    instrfns->table[OP_ADDRESS] = op_address;
-    instrfns->table[OP_BALANCE] = op_balance;
-    instrfns->table[OP_ORIGIN] = op_origin;
-    instrfns->table[OP_CALLER] = op_caller;
-    instrfns->table[OP_CALLVALUE] = op_callvalue;
-    instrfns->table[OP_CALLDATALOAD] = op_calldataload;
-    instrfns->table[OP_CALLDATASIZE] = op_calldatasize;
-    instrfns->table[OP_CALLDATACOPY] = op_calldatacopy;
-    instrfns->table[OP_CODESIZE] = op_codesize;
-    instrfns->table[OP_CODECOPY] = op_codecopy;
-    instrfns->table[OP_GASPRICE] = op_gasprice;
-    instrfns->table[OP_EXTCODESIZE] = op_extcodesize;
-    instrfns->table[OP_EXTCODECOPY] = op_extcodecopy;
-    instrfns->table[OP_RETURNDATASIZE] = op_returndatasize;
-    instrfns->table[OP_RETURNDATACOPY] = op_returndatacopy;
-    instrfns->table[OP_EXTCODEHASH] = op_extcodehash;
-
-    instrfns->table[OP_BLOCKHASH] = op_blockhash;
-    instrfns->table[OP_COINBASE] = op_coinbase;
-    instrfns->table[OP_TIMESTAMP] = op_timestamp;
-    instrfns->table[OP_NUMBER] = op_number;
-    instrfns->table[OP_DIFFICULTY] = op_difficulty;
-    instrfns->table[OP_GASLIMIT] = op_gaslimit;
-    instrfns->table[OP_CHAINID] = op_chainid;
-    instrfns->table[OP_SELFBALANCE] = op_selfbalance;
-    instrfns->table[OP_BASEFEE] = op_basefee;
-
-    instrfns->table[OP_POP] = op_pop;
-    instrfns->table[OP_MLOAD] = op_mload;
-    instrfns->table[OP_MSTORE] = op_mstore;
-    instrfns->table[OP_MSTORE8] = op_mstore8;
-    instrfns->table[OP_SLOAD] = op_sload;
-    instrfns->table[OP_SSTORE] = op_sstore;
-    instrfns->table[OP_JUMP] = op_jump;
-    instrfns->table[OP_JUMPI] = op_jumpi;
-    instrfns->table[OP_PC] = op_pc;
-    instrfns->table[OP_MSIZE] = op_msize;
-    instrfns->table[OP_GAS] = op_gas;
-    instrfns->table[OP_JUMPDEST] = op_jumpdest;
-
-    instrfns->table[OP_PUSH0] = op_push0;
-
-    instrfns->table[OP_PUSH1] = op_push_small;
-    instrfns->table[OP_PUSH2] = op_push_small;
-    instrfns->table[OP_PUSH3] = op_push_small;
-    instrfns->table[OP_PUSH4] = op_push_small;
-    instrfns->table[OP_PUSH5] = op_push_small;
-    instrfns->table[OP_PUSH6] = op_push_small;
-    instrfns->table[OP_PUSH7] = op_push_small;
-    instrfns->table[OP_PUSH8] = op_push_small;
-    instrfns->table[OP_PUSH9] = op_push_full;
-    instrfns->table[OP_PUSH10] = op_push_full;
-    instrfns->table[OP_PUSH11] = op_push_full;
-    instrfns->table[OP_PUSH12] = op_push_full;
-    instrfns->table[OP_PUSH13] = op_push_full;
-    instrfns->table[OP_PUSH14] = op_push_full;
-    instrfns->table[OP_PUSH15] = op_push_full;
-    instrfns->table[OP_PUSH16] = op_push_full;
-    instrfns->table[OP_PUSH17] = op_push_full;
-    instrfns->table[OP_PUSH18] = op_push_full;
-    instrfns->table[OP_PUSH19] = op_push_full;
-    instrfns->table[OP_PUSH20] = op_push_full;
-    instrfns->table[OP_PUSH21] = op_push_full;
-    instrfns->table[OP_PUSH22] = op_push_full;
-    instrfns->table[OP_PUSH23] = op_push_full;
-    instrfns->table[OP_PUSH24] = op_push_full;
-    instrfns->table[OP_PUSH25] = op_push_full;
-    instrfns->table[OP_PUSH26] = op_push_full;
-    instrfns->table[OP_PUSH27] = op_push_full;
-    instrfns->table[OP_PUSH28] = op_push_full;
-    instrfns->table[OP_PUSH29] = op_push_full;
-    instrfns->table[OP_PUSH30] = op_push_full;
-    instrfns->table[OP_PUSH31] = op_push_full;
-    instrfns->table[OP_PUSH32] = op_push_full;
-
-    instrfns->table[OP_DUP1] = op_dup1;
-    instrfns->table[OP_DUP2] = op_dup2;
-    instrfns->table[OP_DUP3] = op_dup3;
-    instrfns->table[OP_DUP4] = op_dup4;
-    instrfns->table[OP_DUP5] = op_dup5;
-    instrfns->table[OP_DUP6] = op_dup6;
-    instrfns->table[OP_DUP7] = op_dup7;
-    instrfns->table[OP_DUP8] = op_dup8;
-    instrfns->table[OP_DUP9] = op_dup9;
-    instrfns->table[OP_DUP10] = op_dup10;
-    instrfns->table[OP_DUP11] = op_dup11;
-    instrfns->table[OP_DUP12] = op_dup12;
-    instrfns->table[OP_DUP13] = op_dup13;
-    instrfns->table[OP_DUP14] = op_dup14;
-    instrfns->table[OP_DUP15] = op_dup15;
-    instrfns->table[OP_DUP16] = op_dup16;
-
-    instrfns->table[OP_SWAP1] = op_swap1;
-    instrfns->table[OP_SWAP2] = op_swap2;
-    instrfns->table[OP_SWAP3] = op_swap3;
-    instrfns->table[OP_SWAP4] = op_swap4;
-    instrfns->table[OP_SWAP5] = op_swap5;
-    instrfns->table[OP_SWAP6] = op_swap6;
-    instrfns->table[OP_SWAP7] = op_swap7;
-    instrfns->table[OP_SWAP8] = op_swap8;
-    instrfns->table[OP_SWAP9] = op_swap9;
-    instrfns->table[OP_SWAP10] = op_swap10;
-    instrfns->table[OP_SWAP11] = op_swap11;
-    instrfns->table[OP_SWAP12] = op_swap12;
-    instrfns->table[OP_SWAP13] = op_swap13;
-    instrfns->table[OP_SWAP14] = op_swap14;
-    instrfns->table[OP_SWAP15] = op_swap15;
-    instrfns->table[OP_SWAP16] = op_swap16;
-
-    instrfns->table[OP_LOG0] = op_log0;
-    instrfns->table[OP_LOG1] = op_log1;
-    instrfns->table[OP_LOG2] = op_log2;
-    instrfns->table[OP_LOG3] = op_log3;
-    instrfns->table[OP_LOG4] = op_log4;
-
-    instrfns->table[OP_CREATE] = op_create;
-    instrfns->table[OP_CALL] = op_call;
-    instrfns->table[OP_CALLCODE] = op_callcode;
-    instrfns->table[OP_RETURN] = op_return;
-    instrfns->table[OP_DELEGATECALL] = op_delegatecall;
-    instrfns->table[OP_CREATE2] = op_create2;
-    instrfns->table[OP_STATICCALL] = op_staticcall;
-    instrfns->table[OP_REVERT] = op_revert;
-    instrfns->table[OP_INVALID] = op_invalid;
-    instrfns->table[OP_SELFDESTRUCT] = op_selfdestruct;
-
-    instrfns->table[OPX_BEGINBLOCK] = opx_beginblock;
-}
-
-OpTable get_op_table(enum evmc_revision rev){
-    struct InstructionFnTable instr_fns;
-    InstructionFnTable_init(&instr_fns);
-
-    OpTable opt;
-    for(size_t i = 0; i < 256; ++i){
-        int16_t gas_cost = *(*(gas_costs + rev) + i);
-        if(gas_cost == -1){
-            opt.table[i].fn = op_undefined;
-            opt.table[i].gas_cost = 0;
-        }else{
-            opt.table[i].fn = instr_fns.table[i];
-            opt.table[i].gas_cost = gas_cost;
-            opt.table[i].stack_req = (*(traits + i)).stack_height_required;
-            opt.table[i].stack_change = (*(traits + i)).stack_height_change;
-        }
+/// Returns the handler of the instruction in the revision, op_undefined if undefined there.
+instruction_exec_fn instruction_fn(enum evmc_revision rev, uint8_t opcode){
+    return gas_costs[rev][opcode] != undefined ? instruction_fns[opcode] : op_undefined;
+}
+
+/// Returns the handler, the base gas cost and the stack requirements of the instruction in the
+/// revision. Undefined instructions cost nothing and require nothing, they end the execution.
+struct OpTableEntry op_table_entry(enum evmc_revision rev, uint8_t opcode){
+    struct OpTableEntry entry = {op_undefined, 0, 0, 0};
+    int16_t gas_cost = gas_costs[rev][opcode];
+    if(gas_cost != undefined){
+        entry.fn = instruction_fns[opcode];
+        entry.gas_cost = gas_cost;
+        entry.stack_req = traits[opcode].stack_height_required;
+        entry.stack_change = traits[opcode].stack_height_change;
     }
-    return opt;
+    return entry;
 } 
\ No newline at end of file
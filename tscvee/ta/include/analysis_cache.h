@@ -0,0 +1,162 @@
+#pragma once
+
+#include "analysis_store.h"
+
+/// The maximum number of analyses kept in the cache.
+#define ANALYSIS_CACHE_ENTRIES 16
+
+/// The byte budget of the cache: CodeAnalysis_size() plus the code copy of every entry.
+#ifndef ANALYSIS_CACHE_BUDGET
+#define ANALYSIS_CACHE_BUDGET (1024 * 1024)
+#endif
+
+struct AnalysisCacheEntry
+{
+    /// The key: the code, the revision and the jump destination index and analysis mode
+    /// options the code has been analyzed with. The code is compared only if its hash matches.
+    uint64_t code_hash;
+    uint8_t *code;
+    size_t code_size;
+    enum evmc_revision rev;
+    enum jumpdest_index_kind jumpdest_index_option;
+    enum analysis_mode analysis_mode_option;
+
+    struct CodeAnalysis analysis;
+    size_t size;
+
+    /// The AnalysisCache::clock value of the last use, 0 if the entry is empty.
+    uint64_t last_use;
+};
+
+/// The cache of finished analyses with the least recently used ones evicted first.
+struct AnalysisCache
+{
+    struct AnalysisCacheEntry entries[ANALYSIS_CACHE_ENTRIES];
+    size_t size;
+    uint64_t clock;
+
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+
+    /// The misses served by analysis_store_load() instead of analyze().
+    uint64_t loads;
+};
+
+/// The cache shared by all executions. In the TA it lives as long as the TA instance, so the
+/// analyses are reused across commands.
+struct AnalysisCache analysis_cache;
+
+/// A fast 64-bit hash of the code, 8 bytes per step.
+///
+/// Keccak-256 would be the natural key, but sha3.c takes longer to hash a contract than
+/// analyze() takes to analyze it. Collisions are harmless as the code is compared on a match.
+uint64_t code_hash64(uint8_t *code, size_t code_size)
+{
+    uint64_t hash = 0x9e3779b97f4a7c15ULL ^ code_size;
+    size_t i = 0;
+    for (; i + 8 <= code_size; i += 8)
+    {
+        uint64_t word;
+        TEE_MemMove(&word, code + i, 8);
+        hash = (hash ^ word) * 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 32;
+    }
+    for (; i < code_size; ++i)
+        hash = (hash ^ code[i]) * 0x100000001b3ULL;
+    return hash;
+}
+
+void AnalysisCache_evict(struct AnalysisCache *cache, struct AnalysisCacheEntry *entry)
+{
+    CodeAnalysis_free(&entry->analysis);
+    TEE_Free(entry->code);
+    cache->size -= entry->size;
+    entry->last_use = 0;
+    ++cache->evictions;
+}
+
+/// Returns the analysis of the code, from the cache or analyzed and inserted into it.
+///
+/// The analysis is owned by the cache. It stays valid until the next call, the only one which
+/// can evict it, so it must not be used past the execution it has been requested for.
+struct CodeAnalysis *AnalysisCache_get(struct AnalysisCache *cache, enum evmc_revision rev, uint8_t *code, size_t code_size)
+{
+    uint64_t code_hash = code_hash64(code, code_size);
+    ++cache->clock;
+
+    for (size_t i = 0; i < ANALYSIS_CACHE_ENTRIES; ++i)
+    {
+        // The lazy analyses have grown with the executions since.
+        struct AnalysisCacheEntry *entry = &cache->entries[i];
+        if (entry->last_use != 0 && entry->analysis.lazy != NULL)
+        {
+            size_t size = CodeAnalysis_size(&entry->analysis) + entry->code_size;
+            cache->size += size - entry->size;
+            entry->size = size;
+        }
+    }
+
+    for (size_t i = 0; i < ANALYSIS_CACHE_ENTRIES; ++i)
+    {
+        struct AnalysisCacheEntry *entry = &cache->entries[i];
+        if (entry->last_use != 0 && entry->code_hash == code_hash && entry->code_size == code_size &&
+            entry->rev == rev && entry->jumpdest_index_option == jumpdest_index_option &&
+            entry->analysis_mode_option == analysis_mode_option && TEE_MemCompare(entry->code, code, code_size) == 0)
+        {
+            entry->last_use = cache->clock;
+            ++cache->hits;
+            return &entry->analysis;
+        }
+    }
+    ++cache->misses;
+
+    // A lazy analysis is not stored, it is incomplete.
+    struct CodeAnalysis analysis;
+    if (select_analysis_mode(code_size) == ANALYSIS_LAZY)
+        analysis = analyze_lazy(rev, code, code_size);
+    else if (analysis_store_load(&analysis, code_hash, rev, code, code_size))
+        ++cache->loads;
+    else
+    {
+        analysis = analyze(rev, code, code_size);
+        analysis_store_save(&analysis, code_hash, rev, code, code_size);
+    }
+    size_t size = CodeAnalysis_size(&analysis) + code_size;
+
+    // Evict until there is an empty entry and the budget allows the new analysis. An analysis
+    // over the whole budget is still cached alone, the next miss evicts it.
+    struct AnalysisCacheEntry *slot;
+    for (;;)
+    {
+        struct AnalysisCacheEntry *lru = NULL;
+        slot = NULL;
+        for (size_t i = 0; i < ANALYSIS_CACHE_ENTRIES; ++i)
+        {
+            struct AnalysisCacheEntry *entry = &cache->entries[i];
+            if (entry->last_use == 0)
+            {
+                if (slot == NULL)
+                    slot = entry;
+            }
+            else if (lru == NULL || entry->last_use < lru->last_use)
+                lru = entry;
+        }
+        if (lru == NULL || (slot != NULL && cache->size + size <= ANALYSIS_CACHE_BUDGET))
+            break;
+        AnalysisCache_evict(cache, lru);
+    }
+
+    slot->code_hash = code_hash;
+    slot->code = (uint8_t *)TEE_Malloc(code_size, TEE_MALLOC_FILL_ZERO);
+    TEE_MemMove(slot->code, code, code_size);
+    slot->code_size = code_size;
+    slot->rev = rev;
+    slot->jumpdest_index_option = jumpdest_index_option;
+    slot->analysis_mode_option = analysis_mode_option;
+    slot->analysis = analysis;
+    slot->size = size;
+    slot->last_use = cache->clock;
+    cache->size += size;
+    return &slot->analysis;
+}
@@ -0,0 +1,183 @@
+#pragma once
+
+#include "analysis_cache.h"
+#include "execution_state_pool.h"
+
+/// The contracts compiled ahead of time: their bytecode translated to C by the tsc-vee-aot
+/// tool (src/aot.c) into aot_contracts.h, built into the VM and executed instead of the
+/// interpreters for the very same code and revision.
+///
+/// The translated code has the blocks of analyze(): the gas and the stack requirements are
+/// checked once per block, the instructions call the instructions.h functions with the stack
+/// top in a local, and the jumps to a PUSHed destination are gotos. The other jumps go through
+/// a switch over the jump destinations of the contract.
+
+/// The translation of a contract, executing it in the state initialized for the call.
+typedef struct evmc_result (*aot_fn)(struct ExecutionState *state);
+
+struct AotContract
+{
+    const char *name;
+    enum evmc_revision rev;
+    const uint8_t *code;
+    size_t code_size;
+
+    /// The code_hash64() of the code.
+    uint64_t code_hash;
+
+    aot_fn execute;
+};
+
+/// Whether the VM executes the contracts of the registry with their translations. The "O"
+/// option "0" keeps the baseline interpreter for all code, as the reference for the translations.
+bool aot_enabled = true;
+
+/// The exit of the translated code, the same as the one of the baseline interpreter.
+struct evmc_result aot_result(struct ExecutionState *state, enum evmc_status_code status)
+{
+    state->status = status;
+    size_t gas_left = (status == EVMC_SUCCESS || status == EVMC_REVERT) ? state->gas_left : 0;
+    size_t output_size = (status == EVMC_SUCCESS || status == EVMC_REVERT) ? state->output_size : 0;
+
+    assert(state->output_size != 0 || state->output_offset == 0);
+    return evmc_make_result(status, gas_left, Memory_data(&(state->memory)) + state->output_offset, output_size);
+}
+
+/// The statements of the translated code. The function of a contract declares the locals
+/// state, bottom, top, status and, with dynamic jumps, destination and has the labels exit
+/// and jump, see aot_write_contract().
+#define AOT_EXIT(code) \
+    do \
+    { \
+        status = (code); \
+        goto exit; \
+    } while (0)
+
+/// The BEGINBLOCK of analyze(): the whole gas of the block and its stack requirements.
+#define AOT_BLOCK(gas_cost, stack_req, stack_max_growth) \
+    do \
+    { \
+        if ((state->gas_left -= (gas_cost)) < 0) \
+            AOT_EXIT(EVMC_OUT_OF_GAS); \
+        if (top - bottom < (stack_req)) \
+            AOT_EXIT(EVMC_STACK_UNDERFLOW); \
+        if (top - bottom + (stack_max_growth) > 1024) \
+            AOT_EXIT(EVMC_STACK_OVERFLOW); \
+    } while (0)
+
+#define AOT_STACK(impl, change) \
+    do \
+    { \
+        impl(makeStackTop(top)); \
+        top += (change); \
+    } while (0)
+
+#define AOT_STATE(impl, change) \
+    do \
+    { \
+        impl(makeStackTop(top), state); \
+        top += (change); \
+    } while (0)
+
+#define AOT_STATUS(impl, change) \
+    do \
+    { \
+        status = impl(makeStackTop(top), state); \
+        top += (change); \
+        if (status != EVMC_SUCCESS) \
+            goto exit; \
+    } while (0)
+
+/// The correction is the part of the block gas after the instruction, charged already but
+/// not spent yet, see INSTRUCTION_GAS_CORRECTION.
+#define AOT_GAS_CORRECTION(impl, change, correction) \
+    do \
+    { \
+        state->gas_left += (correction); \
+        AOT_STATUS(impl, change); \
+        if ((state->gas_left -= (correction)) < 0) \
+            AOT_EXIT(EVMC_OUT_OF_GAS); \
+    } while (0)
+
+#define AOT_GAS(correction) (*++top = (struct uint256_t){.words = {0, 0, 0, (uint64_t)(state->gas_left + (correction))}})
+
+#define AOT_PUSH_SMALL(value) (*++top = (struct uint256_t){.words = {0, 0, 0, (value)}})
+
+/// The words of the value, the most significant first.
+#define AOT_PUSH(w3, w2, w1, w0) (*++top = (struct uint256_t){.words = {(w3), (w2), (w1), (w0)}})
+
+#define AOT_TERMINATE(impl) AOT_EXIT(impl(makeStackTop(top), state).status)
+
+/// A JUMPI to a PUSHed destination, the condition on the top.
+#define AOT_STATIC_JUMPI(label) \
+    do \
+    { \
+        top -= 1; \
+        if (!zero256(top + 1)) \
+            goto label; \
+    } while (0)
+
+#define AOT_BAD_JUMPI() \
+    do \
+    { \
+        top -= 1; \
+        if (!zero256(top + 1)) \
+            AOT_EXIT(EVMC_BAD_JUMP_DESTINATION); \
+    } while (0)
+
+#define AOT_JUMP() \
+    do \
+    { \
+        destination = top--; \
+        goto jump; \
+    } while (0)
+
+#define AOT_JUMPI() \
+    do \
+    { \
+        top -= 2; \
+        if (!zero256(top + 1)) \
+        { \
+            destination = top + 2; \
+            goto jump; \
+        } \
+    } while (0)
+
+/// Leaves the switch over the jump destinations for a destination out of the code.
+#define AOT_DISPATCH(destination) \
+    if (WORD_P(destination, 3) != 0 || WORD_P(destination, 2) != 0 || WORD_P(destination, 1) != 0) \
+        AOT_EXIT(EVMC_BAD_JUMP_DESTINATION); \
+    switch (WORD_P(destination, 0))
+
+#include "aot_contracts.h"
+
+/// Returns the translation of the code, NULL if the code is not in the registry.
+const struct AotContract *aot_find(enum evmc_revision rev, uint8_t *code, size_t code_size)
+{
+    if (!aot_enabled)
+        return NULL;
+
+    uint64_t code_hash = 0;
+    for (size_t i = 0; i < sizeof(aot_contracts) / sizeof(aot_contracts[0]); ++i)
+    {
+        const struct AotContract *contract = &aot_contracts[i];
+        if (contract->code_size != code_size || contract->rev != rev)
+            continue;
+        // Hashed only once a contract of the size is registered.
+        if (code_hash == 0)
+            code_hash = code_hash64(code, code_size);
+        if (contract->code_hash == code_hash && TEE_MemCompare(contract->code, code, code_size) == 0)
+            return contract;
+    }
+    return NULL;
+}
+
+struct evmc_result execute_aot(const struct AotContract *contract, struct evmc_host_context *ctx, enum evmc_revision rev, struct evmc_message *msg, uint8_t *code, size_t code_size)
+{
+    struct AdvancedExecutionState *astate = ExecutionStatePool_acquire(&execution_state_pool, msg, rev, ctx, code, code_size);
+
+    struct evmc_result result = contract->execute(&astate->estate);
+
+    ExecutionStatePool_release(&execution_state_pool, astate);
+    return result;
+}
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <stdio.h>
+#include <stddef.h>
 #include <assert.h>
 
+#include "memory_page_pool.h"
 #include "mocked_host.h"
 #include "uint256.h"
 
@@ -11,19 +13,22 @@ struct StackSpace
 {
     /// The storage allocated for maximum possible number of items.
     /// Items are aligned to 256 bits for better packing in cache lines.
-    struct uint256_t m_stack_space[1024];
+    /// The first slot is the "bottom": it never holds an item, but it is writable so the
+    /// threaded interpreter can spill its cached top item even when the stack is empty.
+    struct uint256_t m_stack_space[1 + 1024];
 };
 
-/// Returns the pointer to the "bottom", i.e. below the stack space.
+/// Returns the pointer to the "bottom", i.e. the slot below the first stack item.
 struct uint256_t *StackSpace_bottom(struct StackSpace *stackspace)
 {
-    return stackspace->m_stack_space - 1;
+    return stackspace->m_stack_space;
 }
 
 /// The EVM memory.
 ///
 /// The implementations uses initial allocation of 4k and then grows capacity with 2x factor.
 /// Some benchmarks has been done to confirm 4k is ok-ish value.
+/// The capacity is a block of pages of the memory_page_pool.
 struct Memory
 {
     /// The size of allocation "page".
@@ -39,30 +44,44 @@ struct Memory
 void Memory_handle_out_of_memory(struct Memory *memory)
 {
     IMSG("Error: out of memory.\n");
+    TEE_Panic(TEE_ERROR_OUT_OF_MEMORY);
 }
 
-void Memory_allocate_capacity(struct Memory *memory)
+/// Grows the memory to the given capacity, a multiple of page_size: in place if the pages
+/// following its block are free, otherwise moved to a new block. Only the used bytes are
+/// copied, the rest is zeroed by Memory_grow().
+void Memory_allocate_capacity(struct Memory *memory, size_t capacity)
 {
-    memory->m_data = (uint8_t*)TEE_Realloc(memory->m_data, memory->m_capacity);
-    if (memory->m_data == NULL)
+    if (memory->m_data != NULL && MemoryPagePool_grow(&memory_page_pool, memory->m_data, capacity / memory->page_size))
+    {
+        memory->m_capacity = capacity;
+        return;
+    }
+    uint8_t *data = MemoryPagePool_get(&memory_page_pool, capacity / memory->page_size);
+    if (data == NULL)
         Memory_handle_out_of_memory(memory);
+    if (memory->m_size != 0)
+        TEE_MemMove(data, memory->m_data, memory->m_size);
+    MemoryPagePool_put(&memory_page_pool, memory->m_data, memory->m_capacity / memory->page_size);
+    memory->m_data = data;
+    memory->m_capacity = capacity;
 }
 
 /// Creates Memory object with initial capacity allocation.
 void Memory_init(struct Memory *memory)
 {
-    memory->page_size = 4 * 1024;
+    memory->page_size = MEMORY_PAGE_SIZE;
     memory->m_data = NULL;
     memory->m_size = 0;
-    memory->m_capacity = memory->page_size;
-    Memory_allocate_capacity(memory);
+    memory->m_capacity = 0;
+    Memory_allocate_capacity(memory, memory->page_size);
     
 }
 
 /// Frees all allocated memory.
 void Memory_free(struct Memory *memory)
 {
-    TEE_Free(memory->m_data);
+    MemoryPagePool_put(&memory_page_pool, memory->m_data, memory->m_capacity / memory->page_size);
 }
 
 uint8_t *Memory_get(struct Memory *memory, size_t index)
@@ -94,14 +113,14 @@ void Memory_grow(struct Memory *memory, size_t new_size)
     if (new_size > memory->m_capacity)
     {
         // Double the capacity.
-        memory->m_capacity *= 2;
+        size_t capacity = memory->m_capacity * 2;
         // If not enough.
-        if (memory->m_capacity < new_size)
+        if (capacity < new_size)
         {
             // Set capacity to required size rounded to multiple of page_size.
-            memory->m_capacity = ((new_size + (memory->page_size - 1)) / memory->page_size) * memory->page_size;
+            capacity = ((new_size + (memory->page_size - 1)) / memory->page_size) * memory->page_size;
         }
-        Memory_allocate_capacity(memory);
+        Memory_allocate_capacity(memory, capacity);
     }
     TEE_MemFill(memory->m_data + memory->m_size, 0, new_size - memory->m_size);
     memory->m_size = new_size;
@@ -113,6 +132,18 @@ void Memory_clear(struct Memory *memory)
     memory->m_size = 0;
 }
 
+/// Clears the memory and gives back its capacity past the given one, a multiple of page_size.
+void Memory_trim(struct Memory *memory, size_t capacity)
+{
+    if (memory->m_capacity <= capacity)
+    {
+        Memory_clear(memory);
+        return;
+    }
+    Memory_free(memory);
+    Memory_init(memory);
+}
+
 //-------------ExecutionState-------------
 typedef uint8_t* bytes;
 
@@ -134,47 +165,67 @@ void bytes_view_init_v(struct bytes_view *bv, uint8_t *byte, uint64_t size)
     bv->size = size;
 }
 
+/// The data of the execution the instructions rarely access, out of the cache lines of the
+/// hot fields of ExecutionState.
+struct ExecutionStateCold
+{
+    /// The tx context, fetched from the host on the first use, see ExecutionState_get_tx_context().
+    struct evmc_tx_context m_tx;
+};
+
 /// Generic execution state for generic instructions implementations.
 struct ExecutionState
 {
+    /// The fields accessed by most instructions, in the first 64 bytes. The AdvancedExecutionState
+    /// aligns the ExecutionState to a cache line, so these are one line.
     int64_t gas_left;
     struct Memory memory;
     struct evmc_message *msg;
-    // struct HostContext host;
-    struct evmc_host_context host_ctx;
+
+    /// The host of the execution, not owned, and the methods to call it with.
+    struct evmc_host_context *host_ctx;
+    const struct HostInterface *host;
+
     enum evmc_revision rev;
+    enum evmc_status_code status;
     bytes return_data;
 
     /// Reference to original EVM code.
     /// TODO: Code should be accessed via code analysis only and this should be removed.
     bytes_view code;
 
-    enum evmc_status_code status;
     size_t output_offset;
     size_t output_size;
 
-    struct evmc_tx_context m_tx;
-
     /// Pointer to code analysis.
     /// This should be set and used internally by execute() function of a particular interpreter.
     union
     {
         struct CodeAnalysis *advanced;
+        struct BaselineCodeAnalysis *baseline;
     } analysis;
 
+    /// Owned, allocated by ExecutionState_init_v().
+    struct ExecutionStateCold *cold;
+
     /// Stack space allocation.
     ///
     /// This is the last field to make other fields' offsets of reasonable values.
     struct StackSpace stack_space;
 };
 
+/// The hot fields in 64 bytes, the line itself is checked with the AdvancedExecutionState.
+_Static_assert(offsetof(struct ExecutionState, host) + sizeof(const struct HostInterface *) <= 64,
+               "the hot fields of ExecutionState must fit in its first 64 bytes");
+
 void ExecutionState_init(struct ExecutionState* execution_state)
 {
     execution_state->gas_left = 0;
     Memory_init(&execution_state->memory);
     execution_state->msg = NULL;
 
-    MockedHost_init(&execution_state->host_ctx);
+    execution_state->host_ctx = NULL;
+    execution_state->host = &mocked_host_interface;
     execution_state->rev = EVMC_LONDON;
     execution_state->return_data = NULL;
 
@@ -183,6 +234,8 @@ void ExecutionState_init(struct ExecutionState* execution_state)
     execution_state->status = EVMC_SUCCESS;
     execution_state->output_offset = 0;
     execution_state->output_size = 0;
+
+    execution_state->cold = (struct ExecutionStateCold *)TEE_Malloc(sizeof(struct ExecutionStateCold), TEE_MALLOC_FILL_ZERO);
 }
 
 void ExecutionState_init_v(struct ExecutionState* execution_state, struct evmc_message* message, enum evmc_revision revision, struct evmc_host_context* host_ctx, uint8_t* code, size_t code_size)
@@ -191,7 +244,8 @@ void ExecutionState_init_v(struct ExecutionState* execution_state, struct evmc_m
     Memory_init(&execution_state->memory);
     execution_state->msg = message;
     
-    execution_state->host_ctx = *host_ctx;
+    execution_state->host_ctx = host_ctx;
+    execution_state->host = &mocked_host_interface;
     execution_state->rev = revision;
     execution_state->return_data = NULL;
     execution_state->code.data = code;
@@ -200,15 +254,21 @@ void ExecutionState_init_v(struct ExecutionState* execution_state, struct evmc_m
     execution_state->status = EVMC_SUCCESS;
     execution_state->output_offset = 0;
     execution_state->output_size = 0;
+    execution_state->analysis.advanced = NULL;
+
+    execution_state->cold = (struct ExecutionStateCold *)TEE_Malloc(sizeof(struct ExecutionStateCold), TEE_MALLOC_FILL_ZERO);
 }
 
+/// Reinitializes the state of a finished execution for the next one, keeping the capacity
+/// of the memory and the cold data allocation.
 void ExecutionState_reset(struct ExecutionState* execution_state, struct evmc_message* message, enum evmc_revision revision, struct evmc_host_context* host_ctx, uint8_t* code, size_t code_size)
 {
     execution_state->gas_left = message->gas;
     Memory_clear(&execution_state->memory);
     execution_state->msg = message;
     
-    MockedHost_init(host_ctx);
+    execution_state->host_ctx = host_ctx;
+    execution_state->host = &mocked_host_interface;
     execution_state->rev = revision;
     execution_state->return_data = NULL;
     execution_state->code.data = code;
@@ -218,7 +278,15 @@ void ExecutionState_reset(struct ExecutionState* execution_state, struct evmc_me
     execution_state->output_offset = 0;
     execution_state->output_size = 0;
     execution_state->analysis.advanced = NULL;
-    evmcContext_init(execution_state->m_tx);
+    // Fetched again from the host of this execution, see ExecutionState_get_tx_context().
+    TEE_MemFill(&execution_state->cold->m_tx, 0, sizeof(execution_state->cold->m_tx));
+}
+
+/// Frees the memory and the cold data of the state.
+void ExecutionState_free(struct ExecutionState* execution_state)
+{
+    Memory_free(&execution_state->memory);
+    TEE_Free(execution_state->cold);
 }
 
 bool ExecutionState_in_static_mode(struct ExecutionState* execution_state){
@@ -226,9 +294,11 @@ bool ExecutionState_in_static_mode(struct ExecutionState* execution_state){
     // return false;
 }
 
-struct evmc_tx_context ExecutionState_get_tx_context(struct ExecutionState* execution_state)
+/// Returns the tx context of the execution, fetched from the host once.
+const struct evmc_tx_context *ExecutionState_get_tx_context(struct ExecutionState* execution_state)
 {
-    if(execution_state->m_tx.block_timestamp == 0)
-        execution_state->m_tx = get_tx_context(&execution_state->host_ctx);
-    return execution_state->m_tx;
+    struct evmc_tx_context *tx = &execution_state->cold->m_tx;
+    if(tx->block_timestamp == 0)
+        *tx = execution_state->host->get_tx_context(execution_state->host_ctx);
+    return tx;
 }
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "analysis.h"
+
+/// The number of idle execution states kept for the next executions.
+#ifndef EXECUTION_STATE_POOL_SIZE
+#define EXECUTION_STATE_POOL_SIZE 4
+#endif
+
+/// The memory capacity an idle state keeps. A state released with more gives the rest back,
+/// see Memory_trim().
+#ifndef EXECUTION_STATE_POOL_MEMORY_LIMIT
+#define EXECUTION_STATE_POOL_MEMORY_LIMIT (256 * 1024)
+#endif
+
+/// The execution states of the finished executions, reused by the next ones instead of
+/// allocating the 32 KB stack space and the memory on every call.
+///
+/// The states are AdvancedExecutionStates, the baseline interpreter and the translated
+/// contracts use their ExecutionState. A nested execution acquires a state of its own.
+struct ExecutionStatePool
+{
+    struct AdvancedExecutionState *idle[EXECUTION_STATE_POOL_SIZE];
+    size_t size;
+
+    uint64_t allocations;
+    uint64_t reuses;
+};
+
+/// The pool shared by all executions. In the TA it lives as long as the TA instance, like
+/// the analysis cache.
+struct ExecutionStatePool execution_state_pool;
+
+/// Allocates a state, 64-byte aligned for the cache lines of its hot fields. TEE_Malloc()
+/// only aligns to 8 or 16 bytes, so the state is placed in a block one alignment larger, the
+/// block kept in the word before the state for ExecutionStatePool_free_state().
+///
+/// Not zero-filled: the state is initialized by the caller and the stack items are written
+/// before they are read.
+struct AdvancedExecutionState *ExecutionStatePool_allocate_state(void)
+{
+    size_t alignment = _Alignof(struct AdvancedExecutionState);
+    uint8_t *block = (uint8_t *)TEE_Malloc(sizeof(struct AdvancedExecutionState) + alignment, TEE_USER_MEM_HINT_NO_FILL_ZERO);
+    if (block == NULL)
+        TEE_Panic(TEE_ERROR_OUT_OF_MEMORY);
+    uint8_t *state = (uint8_t *)(((uintptr_t)block + alignment) & ~(uintptr_t)(alignment - 1));
+    ((uint8_t **)state)[-1] = block;
+    return (struct AdvancedExecutionState *)state;
+}
+
+void ExecutionStatePool_free_state(struct AdvancedExecutionState *state)
+{
+    TEE_Free(((uint8_t **)state)[-1]);
+}
+
+/// Returns a state initialized for the execution, to be given back with
+/// ExecutionStatePool_release() once the result has been made.
+struct AdvancedExecutionState *ExecutionStatePool_acquire(struct ExecutionStatePool *pool, struct evmc_message *msg, enum evmc_revision rev, struct evmc_host_context *ctx, uint8_t *code, size_t code_size)
+{
+    struct AdvancedExecutionState *state;
+    if (pool->size != 0)
+    {
+        state = pool->idle[--pool->size];
+        AdvancedExecutionState_reset(state, msg, rev, ctx, code, code_size);
+        ++pool->reuses;
+    }
+    else
+    {
+        state = ExecutionStatePool_allocate_state();
+        AdvancedExecutionState_init_v(state, msg, rev, ctx, code, code_size);
+        ++pool->allocations;
+    }
+    return state;
+}
+
+void ExecutionStatePool_release(struct ExecutionStatePool *pool, struct AdvancedExecutionState *state)
+{
+    struct Memory *memory = &state->estate.memory;
+    if (pool->size == EXECUTION_STATE_POOL_SIZE)
+    {
+        ExecutionState_free(&state->estate);
+        ExecutionStatePool_free_state(state);
+        return;
+    }
+    if (memory->m_capacity > EXECUTION_STATE_POOL_MEMORY_LIMIT)
+        Memory_trim(memory, EXECUTION_STATE_POOL_MEMORY_LIMIT);
+    pool->idle[pool->size++] = state;
+}
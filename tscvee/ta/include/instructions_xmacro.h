@@ -1,147 +1,159 @@
 #pragma once
 
-#define MAP_OPCODE_TO_IDENTIFIER         \
-    X(OP_STOP, stop)                     \
-    X(OP_ADD, add)                       \
-    X(OP_MUL, mul)                       \
-    X(OP_SUB, sub)                       \
-    X(OP_DIV, div)                       \
-    X(OP_SDIV, sdiv)                     \
-    X(OP_MOD, mod)                       \
-    X(OP_SMOD, smod)                     \
-    X(OP_ADDMOD, addmod)                 \
-    X(OP_MULMOD, mulmod)                 \
-    X(OP_EXP, exp)                       \
-    X(OP_SIGNEXTEND, signextend)         \
-    X(OP_LT, lt)                         \
-    X(OP_GT, gt)                         \
-    X(OP_SLT, slt)                       \
-    X(OP_SGT, sgt)                       \
-    X(OP_EQ, eq)                         \
-    X(OP_ISZERO, iszero)                 \
-    X(OP_AND, and_)                      \
-    X(OP_OR, or_)                        \
-    X(OP_XOR, xor_)                      \
-    X(OP_NOT, not_)                      \
-    X(OP_BYTE, byte)                     \
-    X(OP_SHL, shl)                       \
-    X(OP_SHR, shr)                       \
-    X(OP_SAR, sar)                       \
-    X(OP_KECCAK256, keccak256)           \
-    X(OP_ADDRESS, address)               \
-    X(OP_BALANCE, balance)               \
-    X(OP_ORIGIN, origin)                 \
-    X(OP_CALLER, caller)                 \
-    X(OP_CALLVALUE, callvalue)           \
-    X(OP_CALLDATALOAD, calldataload)     \
-    X(OP_CALLDATASIZE, calldatasize)     \
-    X(OP_CALLDATACOPY, calldatacopy)     \
-    X(OP_CODESIZE, codesize)             \
-    X(OP_CODECOPY, codecopy)             \
-    X(OP_GASPRICE, gasprice)             \
-    X(OP_EXTCODESIZE, extcodesize)       \
-    X(OP_EXTCODECOPY, extcodecopy)       \
-    X(OP_RETURNDATASIZE, returndatasize) \
-    X(OP_RETURNDATACOPY, returndatacopy) \
-    X(OP_EXTCODEHASH, extcodehash)       \
-    X(OP_BLOCKHASH, blockhash)           \
-    X(OP_COINBASE, coinbase)             \
-    X(OP_TIMESTAMP, timestamp)           \
-    X(OP_NUMBER, number)                 \
-    X(OP_DIFFICULTY, difficulty)         \
-    X(OP_GASLIMIT, gaslimit)             \
-    X(OP_CHAINID, chainid)               \
-    X(OP_SELFBALANCE, selfbalance)       \
-    X(OP_BASEFEE, basefee)               \
-    X(OP_POP, pop)                       \
-    X(OP_MLOAD, mload)                   \
-    X(OP_MSTORE, mstore)                 \
-    X(OP_MSTORE8, mstore8)               \
-    X(OP_SLOAD, sload)                   \
-    X(OP_SSTORE, sstore)                 \
-    X(OP_JUMP, jump)                     \
-    X(OP_JUMPI, jumpi)                   \
-    X(OP_PC, pc)                         \
-    X(OP_MSIZE, msize)                   \
-    X(OP_GAS, gas)                       \
-    X(OP_JUMPDEST, jumpdest)             \
-    X(OP_PUSH0, push0)                   \
-    X(OP_PUSH1, push1)                 \
-    X(OP_PUSH2, push<2>)                 \
-    X(OP_PUSH3, push<3>)                 \
-    X(OP_PUSH4, push<4>)                 \
-    X(OP_PUSH5, push<5>)                 \
-    X(OP_PUSH6, push<6>)                 \
-    X(OP_PUSH7, push<7>)                 \
-    X(OP_PUSH8, push<8>)                 \
-    X(OP_PUSH9, push<9>)                 \
-    X(OP_PUSH10, push<10>)               \
-    X(OP_PUSH11, push<11>)               \
-    X(OP_PUSH12, push<12>)               \
-    X(OP_PUSH13, push<13>)               \
-    X(OP_PUSH14, push<14>)               \
-    X(OP_PUSH15, push<15>)               \
-    X(OP_PUSH16, push<16>)               \
-    X(OP_PUSH17, push<17>)               \
-    X(OP_PUSH18, push<18>)               \
-    X(OP_PUSH19, push<19>)               \
-    X(OP_PUSH20, push<20>)               \
-    X(OP_PUSH21, push<21>)               \
-    X(OP_PUSH22, push<22>)               \
-    X(OP_PUSH23, push<23>)               \
-    X(OP_PUSH24, push<24>)               \
-    X(OP_PUSH25, push<25>)               \
-    X(OP_PUSH26, push<26>)               \
-    X(OP_PUSH27, push<27>)               \
-    X(OP_PUSH28, push<28>)               \
-    X(OP_PUSH29, push<29>)               \
-    X(OP_PUSH30, push<30>)               \
-    X(OP_PUSH31, push<31>)               \
-    X(OP_PUSH32, push<32>)               \
-    X(OP_DUP1, dup1)                   \
-    X(OP_DUP2, dup2)                   \
-    X(OP_DUP3, dup3)                   \
-    X(OP_DUP4, dup<4>)                   \
-    X(OP_DUP5, dup<5>)                   \
-    X(OP_DUP6, dup<6>)                   \
-    X(OP_DUP7, dup<7>)                   \
-    X(OP_DUP8, dup<8>)                   \
-    X(OP_DUP9, dup<9>)                   \
-    X(OP_DUP10, dup<10>)                 \
-    X(OP_DUP11, dup<11>)                 \
-    X(OP_DUP12, dup<12>)                 \
-    X(OP_DUP13, dup<13>)                 \
-    X(OP_DUP14, dup<14>)                 \
-    X(OP_DUP15, dup<15>)                 \
-    X(OP_DUP16, dup<16>)                 \
-    X(OP_SWAP1, swap<1>)                 \
-    X(OP_SWAP2, swap<2>)                 \
-    X(OP_SWAP3, swap<3>)                 \
-    X(OP_SWAP4, swap<4>)                 \
-    X(OP_SWAP5, swap<5>)                 \
-    X(OP_SWAP6, swap<6>)                 \
-    X(OP_SWAP7, swap<7>)                 \
-    X(OP_SWAP8, swap<8>)                 \
-    X(OP_SWAP9, swap<9>)                 \
-    X(OP_SWAP10, swap<10>)               \
-    X(OP_SWAP11, swap<11>)               \
-    X(OP_SWAP12, swap<12>)               \
-    X(OP_SWAP13, swap<13>)               \
-    X(OP_SWAP14, swap<14>)               \
-    X(OP_SWAP15, swap<15>)               \
-    X(OP_SWAP16, swap<16>)               \
-    X(OP_LOG0, log<0>)                   \
-    X(OP_LOG1, log<1>)                   \
-    X(OP_LOG2, log<2>)                   \
-    X(OP_LOG3, log<3>)                   \
-    X(OP_LOG4, log<4>)                   \
-    X(OP_CREATE, create)                 \
-    X(OP_CALL, call)                     \
-    X(OP_CALLCODE, callcode)             \
-    X(OP_RETURN, return_)                \
-    X(OP_DELEGATECALL, delegatecall)     \
-    X(OP_CREATE2, create2)               \
-    X(OP_STATICCALL, staticcall)         \
-    X(OP_INVALID, invalid)               \
-    X(OP_REVERT, revert)                 \
-    X(OP_SELFDESTRUCT, selfdestruct)
+/// The table of all EVM instructions, one entry per opcode:
+///
+///     X(opcode, identifier, impl, kind, stack_height_required, stack_height_change, since)
+///
+/// - identifier is the suffix of the op_* handler in analysis.h,
+/// - impl is the instruction implementation in instructions.h,
+/// - kind is the shape of the handler, see the INSTRUCTION_* generators in analysis.h;
+///   the CUSTOM handlers are written by hand,
+/// - since is the EVM revision in which the instruction has been defined.
+///
+/// The traits table and the op_* handlers are both generated from this table, so the stack
+/// height change of an instruction is a compile-time constant in its handler.
+#define MAP_OPCODE_TO_IDENTIFIER \
+    X(OP_STOP,           stop,           stop,           CUSTOM,         0,  0,  EVMC_FRONTIER)       \
+    X(OP_ADD,            add,            add,            STACK,          2,  -1, EVMC_FRONTIER)       \
+    X(OP_MUL,            mul,            mul,            STACK,          2,  -1, EVMC_FRONTIER)       \
+    X(OP_SUB,            sub,            sub,            STACK,          2,  -1, EVMC_FRONTIER)       \
+    X(OP_DIV,            div,            div_,           STACK,          2,  -1, EVMC_FRONTIER)       \
+    X(OP_SDIV,           sdiv,           sdiv,           STACK,          2,  -1, EVMC_FRONTIER)       \
+    X(OP_MOD,            mod,            mod,            STACK,          2,  -1, EVMC_FRONTIER)       \
+    X(OP_SMOD,           smod,           smod,           STACK,          2,  -1, EVMC_FRONTIER)       \
+    X(OP_ADDMOD,         addmod,         addmod,         STACK,          3,  -2, EVMC_FRONTIER)       \
+    X(OP_MULMOD,         mulmod,         mulmod,         STACK,          3,  -2, EVMC_FRONTIER)       \
+    X(OP_EXP,            exp,            exp_,           STATUS,         2,  -1, EVMC_FRONTIER)       \
+    X(OP_SIGNEXTEND,     signextend,     signextend,     STACK,          2,  -1, EVMC_FRONTIER)       \
+    X(OP_LT,             lt,             lt,             STACK,          2,  -1, EVMC_FRONTIER)       \
+    X(OP_GT,             gt,             gt,             STACK,          2,  -1, EVMC_FRONTIER)       \
+    X(OP_SLT,            slt,            slt,            STACK,          2,  -1, EVMC_FRONTIER)       \
+    X(OP_SGT,            sgt,            sgt,            STACK,          2,  -1, EVMC_FRONTIER)       \
+    X(OP_EQ,             eq,             eq,             STACK,          2,  -1, EVMC_FRONTIER)       \
+    X(OP_ISZERO,         iszero,         iszero,         STACK,          1,  0,  EVMC_FRONTIER)       \
+    X(OP_AND,            and,            and_,           STACK,          2,  -1, EVMC_FRONTIER)       \
+    X(OP_OR,             or,             or_,            STACK,          2,  -1, EVMC_FRONTIER)       \
+    X(OP_XOR,            xor,            xor_,           STACK,          2,  -1, EVMC_FRONTIER)       \
+    X(OP_NOT,            not,            not_,           STACK,          1,  0,  EVMC_FRONTIER)       \
+    X(OP_BYTE,           byte,           byte_,          STACK,          2,  -1, EVMC_FRONTIER)       \
+    X(OP_SHL,            shl,            shl,            STACK,          2,  -1, EVMC_CONSTANTINOPLE) \
+    X(OP_SHR,            shr,            shr,            STACK,          2,  -1, EVMC_CONSTANTINOPLE) \
+    X(OP_SAR,            sar,            sar,            STACK,          2,  -1, EVMC_CONSTANTINOPLE) \
+    X(OP_KECCAK256,      keccak256,      keccak256,      STATUS,         2,  -1, EVMC_FRONTIER)       \
+    X(OP_ADDRESS,        address,        address,        STATE,          0,  1,  EVMC_FRONTIER)       \
+    X(OP_BALANCE,        balance,        balance,        STATUS,         1,  0,  EVMC_FRONTIER)       \
+    X(OP_ORIGIN,         origin,         origin,         STATE,          0,  1,  EVMC_FRONTIER)       \
+    X(OP_CALLER,         caller,         caller,         STATE,          0,  1,  EVMC_FRONTIER)       \
+    X(OP_CALLVALUE,      callvalue,      callvalue,      STATE,          0,  1,  EVMC_FRONTIER)       \
+    X(OP_CALLDATALOAD,   calldataload,   calldataload,   STATE,          1,  0,  EVMC_FRONTIER)       \
+    X(OP_CALLDATASIZE,   calldatasize,   calldatasize,   STATE,          0,  1,  EVMC_FRONTIER)       \
+    X(OP_CALLDATACOPY,   calldatacopy,   calldatacopy,   STATUS,         3,  -3, EVMC_FRONTIER)       \
+    X(OP_CODESIZE,       codesize,       codesize,       STATE,          0,  1,  EVMC_FRONTIER)       \
+    X(OP_CODECOPY,       codecopy,       codecopy,       STATUS,         3,  -3, EVMC_FRONTIER)       \
+    X(OP_GASPRICE,       gasprice,       gasprice,       STATE,          0,  1,  EVMC_FRONTIER)       \
+    X(OP_EXTCODESIZE,    extcodesize,    extcodesize,    STATUS,         1,  0,  EVMC_FRONTIER)       \
+    X(OP_EXTCODECOPY,    extcodecopy,    extcodecopy,    STATUS,         4,  -4, EVMC_FRONTIER)       \
+    X(OP_RETURNDATASIZE, returndatasize, returndatasize, STATE,          0,  1,  EVMC_BYZANTIUM)      \
+    X(OP_RETURNDATACOPY, returndatacopy, returndatacopy, STATUS,         3,  -3, EVMC_BYZANTIUM)      \
+    X(OP_EXTCODEHASH,    extcodehash,    extcodehash,    STATUS,         1,  0,  EVMC_CONSTANTINOPLE) \
+    X(OP_BLOCKHASH,      blockhash,      blockhash,      STATE,          1,  0,  EVMC_FRONTIER)       \
+    X(OP_COINBASE,       coinbase,       coinbase,       STATE,          0,  1,  EVMC_FRONTIER)       \
+    X(OP_TIMESTAMP,      timestamp,      timestamp,      STATE,          0,  1,  EVMC_FRONTIER)       \
+    X(OP_NUMBER,         number,         number,         STATE,          0,  1,  EVMC_FRONTIER)       \
+    X(OP_DIFFICULTY,     difficulty,     difficulty,     STATE,          0,  1,  EVMC_FRONTIER)       \
+    X(OP_GASLIMIT,       gaslimit,       gaslimit,       STATE,          0,  1,  EVMC_FRONTIER)       \
+    X(OP_CHAINID,        chainid,        chainid,        STATE,          0,  1,  EVMC_ISTANBUL)       \
+    X(OP_SELFBALANCE,    selfbalance,    selfbalance,    STATE,          0,  1,  EVMC_ISTANBUL)       \
+    X(OP_BASEFEE,        basefee,        basefee,        STATE,          0,  1,  EVMC_LONDON)         \
+    X(OP_POP,            pop,            pop,            STACK,          1,  -1, EVMC_FRONTIER)       \
+    X(OP_MLOAD,          mload,          mload,          STATUS,         1,  0,  EVMC_FRONTIER)       \
+    X(OP_MSTORE,         mstore,         mstore,         STATUS,         2,  -2, EVMC_FRONTIER)       \
+    X(OP_MSTORE8,        mstore8,        mstore8,        STATUS,         2,  -2, EVMC_FRONTIER)       \
+    X(OP_SLOAD,          sload,          sload,          STATUS,         1,  0,  EVMC_FRONTIER)       \
+    X(OP_SSTORE,         sstore,         sstore,         GAS_CORRECTION, 2,  -2, EVMC_FRONTIER)       \
+    X(OP_JUMP,           jump,           jump,           CUSTOM,         1,  -1, EVMC_FRONTIER)       \
+    X(OP_JUMPI,          jumpi,          jumpi,          CUSTOM,         2,  -2, EVMC_FRONTIER)       \
+    X(OP_PC,             pc,             pc,             CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_MSIZE,          msize,          msize,          STATE,          0,  1,  EVMC_FRONTIER)       \
+    X(OP_GAS,            gas,            gas,            CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_JUMPDEST,       jumpdest,       jumpdest,       STACK,          0,  0,  EVMC_FRONTIER)       \
+    X(OP_PUSH0,          push0,          push0,          STATE,          0,  1,  EVMC_SHANGHAI)       \
+    X(OP_PUSH1,          push_small,     push_small,     CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH2,          push_small,     push_small,     CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH3,          push_small,     push_small,     CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH4,          push_small,     push_small,     CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH5,          push_small,     push_small,     CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH6,          push_small,     push_small,     CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH7,          push_small,     push_small,     CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH8,          push_small,     push_small,     CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH9,          push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH10,         push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH11,         push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH12,         push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH13,         push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH14,         push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH15,         push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH16,         push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH17,         push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH18,         push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH19,         push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH20,         push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH21,         push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH22,         push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH23,         push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH24,         push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH25,         push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH26,         push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH27,         push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH28,         push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH29,         push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH30,         push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH31,         push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_PUSH32,         push_full,      push_full,      CUSTOM,         0,  1,  EVMC_FRONTIER)       \
+    X(OP_DUP1,           dup1,           dup1,           STATE,          1,  1,  EVMC_FRONTIER)       \
+    X(OP_DUP2,           dup2,           dup2,           STATE,          2,  1,  EVMC_FRONTIER)       \
+    X(OP_DUP3,           dup3,           dup3,           STATE,          3,  1,  EVMC_FRONTIER)       \
+    X(OP_DUP4,           dup4,           dup4,           STATE,          4,  1,  EVMC_FRONTIER)       \
+    X(OP_DUP5,           dup5,           dup5,           STATE,          5,  1,  EVMC_FRONTIER)       \
+    X(OP_DUP6,           dup6,           dup6,           STATE,          6,  1,  EVMC_FRONTIER)       \
+    X(OP_DUP7,           dup7,           dup7,           STATE,          7,  1,  EVMC_FRONTIER)       \
+    X(OP_DUP8,           dup8,           dup8,           STATE,          8,  1,  EVMC_FRONTIER)       \
+    X(OP_DUP9,           dup9,           dup9,           STATE,          9,  1,  EVMC_FRONTIER)       \
+    X(OP_DUP10,          dup10,          dup10,          STATE,          10, 1,  EVMC_FRONTIER)       \
+    X(OP_DUP11,          dup11,          dup11,          STATE,          11, 1,  EVMC_FRONTIER)       \
+    X(OP_DUP12,          dup12,          dup12,          STATE,          12, 1,  EVMC_FRONTIER)       \
+    X(OP_DUP13,          dup13,          dup13,          STATE,          13, 1,  EVMC_FRONTIER)       \
+    X(OP_DUP14,          dup14,          dup14,          STATE,          14, 1,  EVMC_FRONTIER)       \
+    X(OP_DUP15,          dup15,          dup15,          STATE,          15, 1,  EVMC_FRONTIER)       \
+    X(OP_DUP16,          dup16,          dup16,          STATE,          16, 1,  EVMC_FRONTIER)       \
+    X(OP_SWAP1,          swap1,          swap1,          STATE,          2,  0,  EVMC_FRONTIER)       \
+    X(OP_SWAP2,          swap2,          swap2,          STATE,          3,  0,  EVMC_FRONTIER)       \
+    X(OP_SWAP3,          swap3,          swap3,          STATE,          4,  0,  EVMC_FRONTIER)       \
+    X(OP_SWAP4,          swap4,          swap4,          STATE,          5,  0,  EVMC_FRONTIER)       \
+    X(OP_SWAP5,          swap5,          swap5,          STATE,          6,  0,  EVMC_FRONTIER)       \
+    X(OP_SWAP6,          swap6,          swap6,          STATE,          7,  0,  EVMC_FRONTIER)       \
+    X(OP_SWAP7,          swap7,          swap7,          STATE,          8,  0,  EVMC_FRONTIER)       \
+    X(OP_SWAP8,          swap8,          swap8,          STATE,          9,  0,  EVMC_FRONTIER)       \
+    X(OP_SWAP9,          swap9,          swap9,          STATE,          10, 0,  EVMC_FRONTIER)       \
+    X(OP_SWAP10,         swap10,         swap10,         STATE,          11, 0,  EVMC_FRONTIER)       \
+    X(OP_SWAP11,         swap11,         swap11,         STATE,          12, 0,  EVMC_FRONTIER)       \
+    X(OP_SWAP12,         swap12,         swap12,         STATE,          13, 0,  EVMC_FRONTIER)       \
+    X(OP_SWAP13,         swap13,         swap13,         STATE,          14, 0,  EVMC_FRONTIER)       \
+    X(OP_SWAP14,         swap14,         swap14,         STATE,          15, 0,  EVMC_FRONTIER)       \
+    X(OP_SWAP15,         swap15,         swap15,         STATE,          16, 0,  EVMC_FRONTIER)       \
+    X(OP_SWAP16,         swap16,         swap16,         STATE,          17, 0,  EVMC_FRONTIER)       \
+    X(OP_LOG0,           log0,           log0,           STATUS,         2,  -2, EVMC_FRONTIER)       \
+    X(OP_LOG1,           log1,           log1,           STATUS,         3,  -3, EVMC_FRONTIER)       \
+    X(OP_LOG2,           log2,           log2_,          STATUS,         4,  -4, EVMC_FRONTIER)       \
+    X(OP_LOG3,           log3,           log3,           STATUS,         5,  -5, EVMC_FRONTIER)       \
+    X(OP_LOG4,           log4,           log4,           STATUS,         6,  -6, EVMC_FRONTIER)       \
+    X(OP_CREATE,         create,         create,         GAS_CORRECTION, 3,  -2, EVMC_FRONTIER)       \
+    X(OP_CALL,           call,           call_,          GAS_CORRECTION, 7,  -6, EVMC_FRONTIER)       \
+    X(OP_CALLCODE,       callcode,       callcode,       GAS_CORRECTION, 7,  -6, EVMC_FRONTIER)       \
+    X(OP_RETURN,         return,         return_,        CUSTOM,         2,  -2, EVMC_FRONTIER)       \
+    X(OP_DELEGATECALL,   delegatecall,   delegatecall,   GAS_CORRECTION, 6,  -5, EVMC_HOMESTEAD)      \
+    X(OP_CREATE2,        create2,        create2,        GAS_CORRECTION, 4,  -3, EVMC_CONSTANTINOPLE) \
+    X(OP_STATICCALL,     staticcall,     staticcall,     GAS_CORRECTION, 6,  -5, EVMC_BYZANTIUM)      \
+    X(OP_REVERT,         revert,         revert,         CUSTOM,         2,  -2, EVMC_BYZANTIUM)      \
+    X(OP_INVALID,        invalid,        invalid,        CUSTOM,         0,  0,  EVMC_FRONTIER)       \
+    X(OP_SELFDESTRUCT,   selfdestruct,   selfdestruct_,  CUSTOM,         1,  -1, EVMC_FRONTIER)
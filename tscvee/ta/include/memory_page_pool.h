@@ -0,0 +1,232 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/// The size of the pages of the EVM memory.
+#define MEMORY_PAGE_SIZE 4096
+
+/// The classes of the blocks of the arena, class n holding blocks of 2^n pages. The arena is
+/// the block of the largest class, 128 pages (512 KB) by default.
+#ifndef MEMORY_PAGE_POOL_CLASSES
+#define MEMORY_PAGE_POOL_CLASSES 8
+#endif
+
+#define MEMORY_PAGE_POOL_PAGES ((size_t)1 << (MEMORY_PAGE_POOL_CLASSES - 1))
+
+/// The marks of MemoryPagePool.head.
+#define MEMORY_PAGE_NO_BLOCK 0xff
+#define MEMORY_PAGE_FREE 0x80
+#define MEMORY_PAGE_NONE 0xffff
+
+/// The pages of the EVM memories of the TA.
+///
+/// The memory of an execution stays one contiguous block of pages, so the instructions, the
+/// hashing and the calls keep addressing it with a plain pointer. The blocks are the buddies
+/// of an arena allocated once from the TA_DATA_SIZE heap: a block of 2^n pages starts at a
+/// multiple of 2^n pages and its buddy is the other half of the block of 2^(n+1) pages.
+///
+/// A growing memory takes the free blocks following it, see MemoryPagePool_grow(), so the
+/// doubling of a memory whose buddy is free neither copies nor holds two blocks. Only when the
+/// buddy is taken does the memory move to a new block, copying the used bytes. The blocks given
+/// back merge with their free buddies, and the memories larger than the arena, or those not
+/// fitting in it, are allocated from the heap.
+struct MemoryPagePool
+{
+    uint8_t *arena;
+
+    /// The class of the block starting at the page, with MEMORY_PAGE_FREE if the block is free,
+    /// MEMORY_PAGE_NO_BLOCK for the pages inside the blocks.
+    uint8_t head[MEMORY_PAGE_POOL_PAGES];
+
+    /// The free blocks of each class, doubly linked through the pages of their heads.
+    uint16_t free[MEMORY_PAGE_POOL_CLASSES];
+    uint16_t next[MEMORY_PAGE_POOL_PAGES];
+    uint16_t prev[MEMORY_PAGE_POOL_PAGES];
+
+    /// The free pages of the arena.
+    size_t idle_pages;
+
+    /// The pages of the memories, including those of the states kept by the execution state pool.
+    size_t pages;
+
+    /// The largest pages since MemoryPagePool_begin_execution(), the pages an execution with
+    /// its nested calls needed.
+    size_t peak_pages;
+
+    /// The pages taken from the heap, the arena and the memories outside of it, and their largest.
+    size_t heap_pages;
+    size_t heap_peak_pages;
+
+    uint64_t allocations;
+    uint64_t reuses;
+    uint64_t in_place_growths;
+};
+
+/// The pool shared by all executions, living as long as the TA instance.
+struct MemoryPagePool memory_page_pool;
+
+/// Returns the class of the smallest block of at least the given pages.
+int MemoryPagePool_class(size_t pages)
+{
+    int n = 0;
+    while (((size_t)1 << n) < pages)
+        ++n;
+    return n;
+}
+
+void MemoryPagePool_link(struct MemoryPagePool *pool, size_t page, int n)
+{
+    pool->head[page] = MEMORY_PAGE_FREE | n;
+    pool->prev[page] = MEMORY_PAGE_NONE;
+    pool->next[page] = pool->free[n];
+    if (pool->free[n] != MEMORY_PAGE_NONE)
+        pool->prev[pool->free[n]] = (uint16_t)page;
+    pool->free[n] = (uint16_t)page;
+    pool->idle_pages += (size_t)1 << n;
+}
+
+void MemoryPagePool_unlink(struct MemoryPagePool *pool, size_t page, int n)
+{
+    if (pool->prev[page] != MEMORY_PAGE_NONE)
+        pool->next[pool->prev[page]] = pool->next[page];
+    else
+        pool->free[n] = pool->next[page];
+    if (pool->next[page] != MEMORY_PAGE_NONE)
+        pool->prev[pool->next[page]] = pool->prev[page];
+    pool->head[page] = MEMORY_PAGE_NO_BLOCK;
+    pool->idle_pages -= (size_t)1 << n;
+}
+
+/// Allocates the arena on the first use, returns false if the heap cannot hold it.
+bool MemoryPagePool_init_arena(struct MemoryPagePool *pool)
+{
+    if (pool->arena != NULL)
+        return true;
+    pool->arena = (uint8_t *)TEE_Malloc(MEMORY_PAGE_POOL_PAGES * MEMORY_PAGE_SIZE, TEE_USER_MEM_HINT_NO_FILL_ZERO);
+    if (pool->arena == NULL)
+        return false;
+    ++pool->allocations;
+    pool->heap_pages += MEMORY_PAGE_POOL_PAGES;
+
+    for (size_t page = 0; page < MEMORY_PAGE_POOL_PAGES; ++page)
+        pool->head[page] = MEMORY_PAGE_NO_BLOCK;
+    for (int n = 0; n < MEMORY_PAGE_POOL_CLASSES; ++n)
+        pool->free[n] = MEMORY_PAGE_NONE;
+    MemoryPagePool_link(pool, 0, MEMORY_PAGE_POOL_CLASSES - 1);
+    return true;
+}
+
+bool MemoryPagePool_in_arena(struct MemoryPagePool *pool, uint8_t *block)
+{
+    return pool->arena != NULL && block >= pool->arena && block < pool->arena + MEMORY_PAGE_POOL_PAGES * MEMORY_PAGE_SIZE;
+}
+
+void MemoryPagePool_count(struct MemoryPagePool *pool, size_t pages)
+{
+    pool->pages += pages;
+    if (pool->pages > pool->peak_pages)
+        pool->peak_pages = pool->pages;
+    if (pool->heap_pages > pool->heap_peak_pages)
+        pool->heap_peak_pages = pool->heap_pages;
+}
+
+/// Starts counting the peak pages of an execution.
+void MemoryPagePool_begin_execution(struct MemoryPagePool *pool)
+{
+    pool->peak_pages = pool->pages;
+}
+
+/// Returns a block of at least the given pages, not zeroed, NULL if the heap is exhausted.
+uint8_t *MemoryPagePool_get(struct MemoryPagePool *pool, size_t pages)
+{
+    int n = MemoryPagePool_class(pages);
+    if (n < MEMORY_PAGE_POOL_CLASSES && MemoryPagePool_init_arena(pool))
+    {
+        int k = n;
+        while (k < MEMORY_PAGE_POOL_CLASSES && pool->free[k] == MEMORY_PAGE_NONE)
+            ++k;
+        if (k < MEMORY_PAGE_POOL_CLASSES)
+        {
+            size_t page = pool->free[k];
+            MemoryPagePool_unlink(pool, page, k);
+            // The upper halves stay free, the lower one is split again or taken.
+            while (k > n)
+            {
+                --k;
+                MemoryPagePool_link(pool, page + ((size_t)1 << k), k);
+            }
+            pool->head[page] = (uint8_t)n;
+            ++pool->reuses;
+            MemoryPagePool_count(pool, (size_t)1 << n);
+            return pool->arena + page * MEMORY_PAGE_SIZE;
+        }
+    }
+
+    uint8_t *block = (uint8_t *)TEE_Malloc(pages * MEMORY_PAGE_SIZE, TEE_USER_MEM_HINT_NO_FILL_ZERO);
+    if (block == NULL)
+        return NULL;
+    ++pool->allocations;
+    pool->heap_pages += pages;
+    MemoryPagePool_count(pool, pages);
+    return block;
+}
+
+/// Grows the block returned by MemoryPagePool_get() for the given pages to the new pages
+/// without moving it. Returns false if the blocks following it are not free.
+bool MemoryPagePool_grow(struct MemoryPagePool *pool, uint8_t *block, size_t new_pages)
+{
+    if (!MemoryPagePool_in_arena(pool, block))
+        return false;
+    size_t page = (size_t)(block - pool->arena) / MEMORY_PAGE_SIZE;
+    int n = pool->head[page];
+    int m = MemoryPagePool_class(new_pages);
+    if (m <= n)
+        return true;
+    if (m >= MEMORY_PAGE_POOL_CLASSES || page % ((size_t)1 << m) != 0)
+        return false;
+
+    // The block of 2^m pages is the block and the buddies of its classes n to m - 1.
+    for (int k = n; k < m; ++k)
+    {
+        if (pool->head[page + ((size_t)1 << k)] != (MEMORY_PAGE_FREE | k))
+            return false;
+    }
+    for (int k = n; k < m; ++k)
+        MemoryPagePool_unlink(pool, page + ((size_t)1 << k), k);
+    pool->head[page] = (uint8_t)m;
+    ++pool->in_place_growths;
+    MemoryPagePool_count(pool, ((size_t)1 << m) - ((size_t)1 << n));
+    return true;
+}
+
+/// Gives back a block returned by MemoryPagePool_get() for the given pages.
+void MemoryPagePool_put(struct MemoryPagePool *pool, uint8_t *block, size_t pages)
+{
+    if (block == NULL)
+        return;
+    if (!MemoryPagePool_in_arena(pool, block))
+    {
+        pool->pages -= pages;
+        pool->heap_pages -= pages;
+        TEE_Free(block);
+        return;
+    }
+
+    size_t page = (size_t)(block - pool->arena) / MEMORY_PAGE_SIZE;
+    int n = pool->head[page];
+    pool->pages -= (size_t)1 << n;
+    pool->head[page] = MEMORY_PAGE_NO_BLOCK;
+    // Merged with the free buddies into the largest free block.
+    while (n < MEMORY_PAGE_POOL_CLASSES - 1)
+    {
+        size_t buddy = page ^ ((size_t)1 << n);
+        if (pool->head[buddy] != (MEMORY_PAGE_FREE | n))
+            break;
+        MemoryPagePool_unlink(pool, buddy, n);
+        page &= ~((size_t)1 << n);
+        ++n;
+    }
+    MemoryPagePool_link(pool, page, n);
+}
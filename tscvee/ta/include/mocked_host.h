@@ -664,4 +664,41 @@ enum evmc_access_status access_storage(MockedHost *mockhost, evmc_address addr,
     svalue.access_status = EVMC_ACCESS_WARM;
     storage_map_insert_or_assign(&(acc->storage), key, svalue);
     return access_status;
-}
\ No newline at end of file
+}
+/// The host methods the VM calls, the counterpart of evmc_host_interface with the signatures
+/// of the functions above. The execution state keeps a pointer to the table along with the
+/// one to its host context, so the host is neither copied nor bound at compile time.
+struct HostInterface
+{
+    bool (*account_exists)(MockedHost *mockhost, evmc_address addr);
+    evmc_bytes32 (*get_storage)(MockedHost *mockhost, evmc_address addr, evmc_bytes32 key);
+    enum evmc_storage_status (*set_storage)(MockedHost *mockhost, evmc_address addr, evmc_bytes32 key, evmc_bytes32 value);
+    evmc_uint256be (*get_balance)(MockedHost *mockhost, evmc_address addr);
+    size_t (*get_code_size)(MockedHost *mockhost, evmc_address addr);
+    evmc_bytes32 (*get_code_hash)(MockedHost *mockhost, evmc_address addr);
+    size_t (*copy_code)(MockedHost *mockhost, evmc_address addr, size_t code_offset, uint8_t *buffer_data, size_t buffer_size);
+    void (*selfdestruct)(MockedHost *mockhost, evmc_address addr, evmc_address beneficiary);
+    struct evmc_result (*call)(MockedHost *mockhost, struct evmc_message msg);
+    struct evmc_tx_context (*get_tx_context)(MockedHost *mockhost);
+    evmc_bytes32 (*get_block_hash)(MockedHost *mockhost, int64_t block_number);
+    void (*emit_log)(MockedHost *mockhost, evmc_address addr, uint8_t *data, size_t data_size, evmc_bytes32 topics[], size_t topics_count);
+    enum evmc_access_status (*access_account)(MockedHost *mockhost, evmc_address addr);
+    enum evmc_access_status (*access_storage)(MockedHost *mockhost, evmc_address addr, evmc_bytes32 key);
+};
+
+const struct HostInterface mocked_host_interface = {
+    account_exists,
+    get_storage,
+    set_storage,
+    get_balance,
+    get_code_size,
+    get_code_hash,
+    copy_code,
+    selfdestruct,
+    call,
+    get_tx_context,
+    get_block_hash,
+    emit_log,
+    access_account,
+    access_storage,
+};
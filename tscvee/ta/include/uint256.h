@@ -8,9 +8,15 @@ struct uint128_t
 	uint64_t elements[2];
 };
 
+/// A 256-bit number stored as four flat 64-bit words, most significant word first.
+/// The nested 128-bit view is kept so UPPER()/LOWER() keep working.
 struct uint256_t
 {
-	struct uint128_t elements[2];
+	union
+	{
+		struct uint128_t elements[2];
+		uint64_t words[4];
+	};
 };
 
 #define UPPER_P(x) x->elements[0]
@@ -18,6 +24,10 @@ struct uint256_t
 #define UPPER(x) x.elements[0]
 #define LOWER(x) x.elements[1]
 
+/// Flat word access, WORD(x, 0) being the least significant 64-bit word.
+#define WORD_P(x, i) x->words[3 - (i)]
+#define WORD(x, i) x.words[3 - (i)]
+
 uint64_t readUint64BE(uint8_t *buffer);
 void readu128BE(uint8_t *buffer, struct uint128_t *target);
 void readu256BE(uint8_t *buffer, struct uint256_t *target);
@@ -53,8 +63,13 @@ void not128(struct uint128_t *number, struct uint128_t *target);
 void not256(struct uint256_t *number, struct uint256_t *target);
 void mul128(struct uint128_t *number1, struct uint128_t *number2, struct uint128_t *target);
 void mul256(struct uint256_t *number1, struct uint256_t *number2, struct uint256_t *target);
+void mulfull256(struct uint256_t *number1, struct uint256_t *number2, struct uint256_t *high,
+				struct uint256_t *low);
+void exp256(struct uint256_t *base, struct uint256_t *exponent, struct uint256_t *target);
 void divmod128(struct uint128_t *l, struct uint128_t *r, struct uint128_t *div, struct uint128_t *mod);
 void divmod256(struct uint256_t *l, struct uint256_t *r, struct uint256_t *div, struct uint256_t *mod);
+void addmod256(struct uint256_t *x, struct uint256_t *y, struct uint256_t *m, struct uint256_t *target);
+void mulmod256(struct uint256_t *x, struct uint256_t *y, struct uint256_t *m, struct uint256_t *target);
 bool tostring128(struct uint128_t *number, uint32_t base, char *out,
 				 uint32_t outLength);
 bool tostring256(struct uint256_t *number, uint32_t base, char *out,
@@ -2,6 +2,49 @@
 
 static const char HEXDIGITS[] = "0123456789abcdef";
 
+/// Full 64 x 64 -> 128 bit multiplication. Returns the low word, the high word goes to *hi.
+static inline uint64_t umul(uint64_t x, uint64_t y, uint64_t *hi)
+{
+#ifdef __SIZEOF_INT128__
+	unsigned __int128 p = (unsigned __int128)x * y;
+	*hi = (uint64_t)(p >> 64);
+	return (uint64_t)p;
+#else
+	uint64_t xl = x & 0xffffffff;
+	uint64_t xh = x >> 32;
+	uint64_t yl = y & 0xffffffff;
+	uint64_t yh = y >> 32;
+	uint64_t t0 = xl * yl;
+	uint64_t t1 = xh * yl;
+	uint64_t t2 = xl * yh;
+	uint64_t t3 = xh * yh;
+	uint64_t u1 = t1 + (t0 >> 32);
+	uint64_t u2 = t2 + (u1 & 0xffffffff);
+	*hi = t3 + (u1 >> 32) + (u2 >> 32);
+	return (u2 << 32) | (t0 & 0xffffffff);
+#endif
+}
+
+/// Addition with carry in/out. The carry is 0 or 1.
+static inline uint64_t addc(uint64_t x, uint64_t y, uint64_t *carry)
+{
+	uint64_t s = x + y;
+	uint64_t c = s < x;
+	uint64_t r = s + *carry;
+	*carry = c | (r < s);
+	return r;
+}
+
+/// Subtraction with borrow in/out. The borrow is 0 or 1.
+static inline uint64_t subb(uint64_t x, uint64_t y, uint64_t *borrow)
+{
+	uint64_t d = x - y;
+	uint64_t b = x < y;
+	uint64_t r = d - *borrow;
+	*borrow = b | (d < *borrow);
+	return r;
+}
+
 uint64_t readUint64BE(uint8_t *buffer)
 {
 	return (((uint64_t)buffer[0]) << 56) | (((uint64_t)buffer[1]) << 48) |
@@ -29,7 +72,7 @@ bool zero128(struct uint128_t *number)
 
 bool zero256(struct uint256_t *number)
 {
-	return (zero128(&LOWER_P(number)) && zero128(&UPPER_P(number)));
+	return (WORD_P(number, 0) | WORD_P(number, 1) | WORD_P(number, 2) | WORD_P(number, 3)) == 0;
 }
 
 void copy128(struct uint128_t *target, struct uint128_t *number)
@@ -40,8 +83,7 @@ void copy128(struct uint128_t *target, struct uint128_t *number)
 
 void copy256(struct uint256_t *target, struct uint256_t *number)
 {
-	copy128(&UPPER_P(target), &UPPER_P(number));
-	copy128(&LOWER_P(target), &LOWER_P(number));
+	*target = *number;
 }
 
 void clear128(struct uint128_t *target)
@@ -52,8 +94,10 @@ void clear128(struct uint128_t *target)
 
 void clear256(struct uint256_t *target)
 {
-	clear128(&UPPER_P(target));
-	clear128(&LOWER_P(target));
+	WORD_P(target, 0) = 0;
+	WORD_P(target, 1) = 0;
+	WORD_P(target, 2) = 0;
+	WORD_P(target, 3) = 0;
 }
 
 void shiftl128(struct uint128_t *number, uint32_t value, struct uint128_t *target)
@@ -90,39 +134,20 @@ void shiftl128(struct uint128_t *number, uint32_t value, struct uint128_t *targe
 
 void shiftl256(struct uint256_t *number, uint32_t value, struct uint256_t *target)
 {
-	if (value >= 256)
-	{
-		clear256(target);
-	}
-	else if (value == 128)
-	{
-		copy128(&UPPER_P(target), &LOWER_P(number));
-		clear128(&LOWER_P(target));
-	}
-	else if (value == 0)
-	{
-		copy256(target, number);
-	}
-	else if (value < 128)
+	struct uint256_t result = {0, 0, 0, 0};
+	if (value < 256)
 	{
-		struct uint128_t tmp1;
-		struct uint128_t tmp2;
-		struct uint256_t result;
-		shiftl128(&UPPER_P(number), value, &tmp1);
-		shiftr128(&LOWER_P(number), (128 - value), &tmp2);
-		add128(&tmp1, &tmp2, &UPPER(result));
-		shiftl128(&LOWER_P(number), value, &LOWER(result));
-		copy256(target, &result);
-	}
-	else if ((256 > value) && (value > 128))
-	{
-		shiftl128(&LOWER_P(number), (value - 128), &UPPER_P(target));
-		clear128(&LOWER_P(target));
-	}
-	else
-	{
-		clear256(target);
+		uint32_t skip = value / 64;
+		uint32_t shift = value % 64;
+		// (x >> 1) >> (63 - shift) is x >> (64 - shift) without the undefined shift by 64.
+		for (uint32_t i = skip; i < 4; ++i)
+		{
+			uint64_t high = WORD_P(number, i - skip);
+			uint64_t low = (i > skip) ? WORD_P(number, i - skip - 1) : 0;
+			WORD(result, i) = (high << shift) | ((low >> 1) >> (63 - shift));
+		}
 	}
+	*target = result;
 }
 
 void shiftr128(struct uint128_t *number, uint32_t value, struct uint128_t *target)
@@ -161,39 +186,19 @@ void shiftr128(struct uint128_t *number, uint32_t value, struct uint128_t *targe
 
 void shiftr256(struct uint256_t *number, uint32_t value, struct uint256_t *target)
 {
-	if (value >= 256)
-	{
-		clear256(target);
-	}
-	else if (value == 128)
-	{
-		copy128(&LOWER_P(target), &UPPER_P(number));
-		clear128(&UPPER_P(target));
-	}
-	else if (value == 0)
-	{
-		copy256(target, number);
-	}
-	else if (value < 128)
-	{
-		struct uint128_t tmp1;
-		struct uint128_t tmp2;
-		struct uint256_t result;
-		shiftr128(&UPPER_P(number), value, &UPPER(result));
-		shiftr128(&LOWER_P(number), value, &tmp1);
-		shiftl128(&UPPER_P(number), (128 - value), &tmp2);
-		add128(&tmp1, &tmp2, &LOWER(result));
-		copy256(target, &result);
-	}
-	else if ((256 > value) && (value > 128))
+	struct uint256_t result = {0, 0, 0, 0};
+	if (value < 256)
 	{
-		shiftr128(&UPPER_P(number), (value - 128), &LOWER_P(target));
-		clear128(&UPPER_P(target));
-	}
-	else
-	{
-		clear256(target);
+		uint32_t skip = value / 64;
+		uint32_t shift = value % 64;
+		for (uint32_t i = 0; i + skip < 4; ++i)
+		{
+			uint64_t low = WORD_P(number, i + skip);
+			uint64_t high = (i + skip < 3) ? WORD_P(number, i + skip + 1) : 0;
+			WORD(result, i) = (low >> shift) | ((high << 1) << (63 - shift));
+		}
 	}
+	*target = result;
 }
 
 uint32_t bits128(struct uint128_t *number)
@@ -223,29 +228,12 @@ uint32_t bits128(struct uint128_t *number)
 
 uint32_t bits256(struct uint256_t *number)
 {
-	uint32_t result = 0;
-	if (!zero128(&UPPER_P(number)))
-	{
-		result = 128;
-		struct uint128_t up;
-		copy128(&up, &UPPER_P(number));
-		while (!zero128(&up))
-		{
-			shiftr128(&up, 1, &up);
-			result++;
-		}
-	}
-	else
+	for (int i = 3; i >= 0; --i)
 	{
-		struct uint128_t low;
-		copy128(&low, &LOWER_P(number));
-		while (!zero128(&low))
-		{
-			shiftr128(&low, 1, &low);
-			result++;
-		}
+		if (WORD_P(number, i))
+			return (uint32_t)(64 * i + 64 - __builtin_clzll(WORD_P(number, i)));
 	}
-	return result;
+	return 0;
 }
 
 bool equal128(struct uint128_t *number1, struct uint128_t *number2)
@@ -256,8 +244,8 @@ bool equal128(struct uint128_t *number1, struct uint128_t *number2)
 
 bool equal256(struct uint256_t *number1, struct uint256_t *number2)
 {
-	return (equal128(&UPPER_P(number1), &UPPER_P(number2)) &&
-			equal128(&LOWER_P(number1), &LOWER_P(number2)));
+	return ((WORD_P(number1, 0) ^ WORD_P(number2, 0)) | (WORD_P(number1, 1) ^ WORD_P(number2, 1)) |
+			(WORD_P(number1, 2) ^ WORD_P(number2, 2)) | (WORD_P(number1, 3) ^ WORD_P(number2, 3))) == 0;
 }
 
 bool gt128(struct uint128_t *number1, struct uint128_t *number2)
@@ -271,11 +259,11 @@ bool gt128(struct uint128_t *number1, struct uint128_t *number2)
 
 bool gt256(struct uint256_t *number1, struct uint256_t *number2)
 {
-	if (equal128(&UPPER_P(number1), &UPPER_P(number2)))
-	{
-		return gt128(&LOWER_P(number1), &LOWER_P(number2));
-	}
-	return gt128(&UPPER_P(number1), &UPPER_P(number2));
+	// number1 > number2 exactly when number2 - number1 borrows.
+	uint64_t borrow = 0;
+	for (int i = 0; i < 4; ++i)
+		subb(WORD_P(number2, i), WORD_P(number1, i), &borrow);
+	return borrow;
 }
 
 bool gte128(struct uint128_t *number1, struct uint128_t *number2)
@@ -285,7 +273,7 @@ bool gte128(struct uint128_t *number1, struct uint128_t *number2)
 
 bool gte256(struct uint256_t *number1, struct uint256_t *number2)
 {
-	return gt256(number1, number2) || equal256(number1, number2);
+	return !gt256(number2, number1);
 }
 
 void add128(struct uint128_t *number1, struct uint128_t *number2, struct uint128_t *target)
@@ -298,17 +286,9 @@ void add128(struct uint128_t *number1, struct uint128_t *number2, struct uint128
 
 void add256(struct uint256_t *number1, struct uint256_t *number2, struct uint256_t *target)
 {
-	struct uint128_t tmp;
-	add128(&UPPER_P(number1), &UPPER_P(number2), &UPPER_P(target));
-	add128(&LOWER_P(number1), &LOWER_P(number2), &tmp);
-	if (gt128(&LOWER_P(number1), &tmp))
-	{
-		struct uint128_t one;
-		UPPER(one) = 0;
-		LOWER(one) = 1;
-		add128(&UPPER_P(target), &one, &UPPER_P(target));
-	}
-	add128(&LOWER_P(number1), &LOWER_P(number2), &LOWER_P(target));
+	uint64_t carry = 0;
+	for (int i = 0; i < 4; ++i)
+		WORD_P(target, i) = addc(WORD_P(number1, i), WORD_P(number2, i), &carry);
 }
 
 void minus128(struct uint128_t *number1, struct uint128_t *number2, struct uint128_t *target)
@@ -321,17 +301,9 @@ void minus128(struct uint128_t *number1, struct uint128_t *number2, struct uint1
 
 void minus256(struct uint256_t *number1, struct uint256_t *number2, struct uint256_t *target)
 {
-	struct uint128_t tmp;
-	minus128(&UPPER_P(number1), &UPPER_P(number2), &UPPER_P(target));
-	minus128(&LOWER_P(number1), &LOWER_P(number2), &tmp);
-	if (gt128(&tmp, &LOWER_P(number1)))
-	{
-		struct uint128_t one;
-		UPPER(one) = 0;
-		LOWER(one) = 1;
-		minus128(&UPPER_P(target), &one, &UPPER_P(target));
-	}
-	minus128(&LOWER_P(number1), &LOWER_P(number2), &LOWER_P(target));
+	uint64_t borrow = 0;
+	for (int i = 0; i < 4; ++i)
+		WORD_P(target, i) = subb(WORD_P(number1, i), WORD_P(number2, i), &borrow);
 }
 
 void or128(struct uint128_t *number1, struct uint128_t *number2, struct uint128_t *target)
@@ -342,8 +314,8 @@ void or128(struct uint128_t *number1, struct uint128_t *number2, struct uint128_
 
 void or256(struct uint256_t *number1, struct uint256_t *number2, struct uint256_t *target)
 {
-	or128(&UPPER_P(number1), &UPPER_P(number2), &UPPER_P(target));
-	or128(&LOWER_P(number1), &LOWER_P(number2), &LOWER_P(target));
+	for (int i = 0; i < 4; ++i)
+		target->words[i] = number1->words[i] | number2->words[i];
 }
 
 void xor128(struct uint128_t *number1, struct uint128_t *number2, struct uint128_t *target)
@@ -353,8 +325,8 @@ void xor128(struct uint128_t *number1, struct uint128_t *number2, struct uint128
 }
 void xor256(struct uint256_t *number1, struct uint256_t *number2, struct uint256_t *target)
 {
-	xor128(&UPPER_P(number1), &UPPER_P(number2), &UPPER_P(target));
-	xor128(&LOWER_P(number1), &LOWER_P(number2), &LOWER_P(target));
+	for (int i = 0; i < 4; ++i)
+		target->words[i] = number1->words[i] ^ number2->words[i];
 }
 
 void and128(struct uint128_t *number1, struct uint128_t *number2, struct uint128_t *target)
@@ -364,8 +336,8 @@ void and128(struct uint128_t *number1, struct uint128_t *number2, struct uint128
 }
 void and256(struct uint256_t *number1, struct uint256_t *number2, struct uint256_t *target)
 {
-	and128(&UPPER_P(number1), &UPPER_P(number2), &UPPER_P(target));
-	and128(&LOWER_P(number1), &LOWER_P(number2), &LOWER_P(target));
+	for (int i = 0; i < 4; ++i)
+		target->words[i] = number1->words[i] & number2->words[i];
 }
 
 void not128(struct uint128_t *number, struct uint128_t *target)
@@ -376,150 +348,129 @@ void not128(struct uint128_t *number, struct uint128_t *target)
 
 void not256(struct uint256_t *number, struct uint256_t *target)
 {
-	not128(&UPPER_P(number), &UPPER_P(target));
-	not128(&LOWER_P(number), &LOWER_P(target));
+	for (int i = 0; i < 4; ++i)
+		target->words[i] = ~number->words[i];
 }
 
 void mul128(struct uint128_t *number1, struct uint128_t *number2, struct uint128_t *target)
 {
-	uint64_t top[4] = {UPPER_P(number1) >> 32, UPPER_P(number1) & 0xffffffff,
-					   LOWER_P(number1) >> 32, LOWER_P(number1) & 0xffffffff};
-	uint64_t bottom[4] = {UPPER_P(number2) >> 32, UPPER_P(number2) & 0xffffffff,
-						  LOWER_P(number2) >> 32,
-						  LOWER_P(number2) & 0xffffffff};
-	uint64_t products[4][4];
-	struct uint128_t tmp, tmp2;
+	uint64_t high;
+	uint64_t low = umul(LOWER_P(number1), LOWER_P(number2), &high);
+	UPPER_P(target) = high + UPPER_P(number1) * LOWER_P(number2) + LOWER_P(number1) * UPPER_P(number2);
+	LOWER_P(target) = low;
+}
+
+/// Truncated schoolbook multiplication: only the products landing in the low 256 bits are computed.
+void mul256(struct uint256_t *number1, struct uint256_t *number2, struct uint256_t *target)
+{
+	uint64_t result[4] = {0, 0, 0, 0};
+	for (int j = 0; j < 4; ++j)
+	{
+		uint64_t carry = 0;
+		for (int i = 0; i < 4 - j; ++i)
+		{
+			uint64_t high, c1 = 0, c2 = 0;
+			uint64_t low = umul(WORD_P(number1, i), WORD_P(number2, j), &high);
+			low = addc(low, result[i + j], &c1);
+			low = addc(low, carry, &c2);
+			result[i + j] = low;
+			carry = high + c1 + c2;
+		}
+	}
+	for (int i = 0; i < 4; ++i)
+		WORD_P(target, i) = result[i];
+}
 
-	for (int y = 3; y > -1; y--)
+/// Full schoolbook multiplication, the 512-bit product is returned as two 256-bit halves.
+void mulfull256(struct uint256_t *number1, struct uint256_t *number2, struct uint256_t *high,
+				struct uint256_t *low)
+{
+	uint64_t result[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+	for (int j = 0; j < 4; ++j)
 	{
-		for (int x = 3; x > -1; x--)
+		uint64_t carry = 0;
+		for (int i = 0; i < 4; ++i)
 		{
-			products[3 - x][y] = top[x] * bottom[y];
+			uint64_t h, c1 = 0, c2 = 0;
+			uint64_t l = umul(WORD_P(number1, i), WORD_P(number2, j), &h);
+			l = addc(l, result[i + j], &c1);
+			l = addc(l, carry, &c2);
+			result[i + j] = l;
+			carry = h + c1 + c2;
 		}
+		result[j + 4] = carry;
+	}
+	for (int i = 0; i < 4; ++i)
+	{
+		WORD_P(low, i) = result[i];
+		WORD_P(high, i) = result[i + 4];
 	}
+}
 
-	uint64_t fourth32 = products[0][3] & 0xffffffff;
-	uint64_t third32 = (products[0][2] & 0xffffffff) + (products[0][3] >> 32);
-	uint64_t second32 = (products[0][1] & 0xffffffff) + (products[0][2] >> 32);
-	uint64_t first32 = (products[0][0] & 0xffffffff) + (products[0][1] >> 32);
+static bool bit256(struct uint256_t *number, uint32_t index)
+{
+	return (WORD_P(number, index / 64) >> (index % 64)) & 1;
+}
 
-	third32 += products[1][3] & 0xffffffff;
-	second32 += (products[1][2] & 0xffffffff) + (products[1][3] >> 32);
-	first32 += (products[1][1] & 0xffffffff) + (products[1][2] >> 32);
+void exp256(struct uint256_t *base, struct uint256_t *exponent, struct uint256_t *target)
+{
+	struct uint256_t one = {0, 0, 0, 1};
+	struct uint256_t result, tmp;
 
-	second32 += products[2][3] & 0xffffffff;
-	first32 += (products[2][2] & 0xffffffff) + (products[2][3] >> 32);
+	if (zero256(exponent))
+	{
+		copy256(target, &one);
+		return;
+	}
+	if (zero256(base) || equal256(base, &one))
+	{
+		copy256(target, base);
+		return;
+	}
 
-	first32 += products[3][3] & 0xffffffff;
+	// The exponent is known to be non-zero from here on.
+	bool small_exponent = zero128(&UPPER_P(exponent)) && UPPER(LOWER_P(exponent)) == 0;
+	uint64_t e = LOWER(LOWER_P(exponent));
 
-	UPPER(tmp) = first32 << 32;
-	LOWER(tmp) = 0;
-	UPPER(tmp2) = third32 >> 32;
-	LOWER(tmp2) = third32 << 32;
-	add128(&tmp, &tmp2, target);
-	UPPER(tmp) = second32;
-	LOWER(tmp) = 0;
-	add128(&tmp, target, &tmp2);
-	UPPER(tmp) = 0;
-	LOWER(tmp) = fourth32;
-	add128(&tmp, &tmp2, target);
-}
+	// Power of two base: (2^k)^e = 2^(k*e), computed with a single shift.
+	uint32_t base_bits = bits256(base);
+	shiftl256(&one, base_bits - 1, &tmp);
+	if (equal256(base, &tmp))
+	{
+		uint32_t k = base_bits - 1;
+		if (!small_exponent || e >= 256 || k * e >= 256)
+			clear256(target);
+		else
+			shiftl256(&one, (uint32_t)(k * e), target);
+		return;
+	}
 
-void mul256(struct uint256_t *number1, struct uint256_t *number2, struct uint256_t *target)
-{
-	struct uint128_t top[4];
-	struct uint128_t bottom[4];
-	struct uint128_t products[4][4];
-	struct uint128_t tmp, tmp2, fourth64, third64, second64, first64;
-	struct uint256_t target1, target2;
-	UPPER(top[0]) = 0;
-	LOWER(top[0]) = UPPER(UPPER_P(number1));
-	UPPER(top[1]) = 0;
-	LOWER(top[1]) = LOWER(UPPER_P(number1));
-	UPPER(top[2]) = 0;
-	LOWER(top[2]) = UPPER(LOWER_P(number1));
-	UPPER(top[3]) = 0;
-	LOWER(top[3]) = LOWER(LOWER_P(number1));
-	UPPER(bottom[0]) = 0;
-	LOWER(bottom[0]) = UPPER(UPPER_P(number2));
-	UPPER(bottom[1]) = 0;
-	LOWER(bottom[1]) = LOWER(UPPER_P(number2));
-	UPPER(bottom[2]) = 0;
-	LOWER(bottom[2]) = UPPER(LOWER_P(number2));
-	UPPER(bottom[3]) = 0;
-	LOWER(bottom[3]) = LOWER(LOWER_P(number2));
-
-	for (int y = 3; y > -1; y--)
-	{
-		for (int x = 3; x > -1; x--)
+	// Small exponents do not need the square-and-multiply bookkeeping.
+	if (small_exponent && e <= 3)
+	{
+		copy256(&result, base);
+		for (uint64_t i = 1; i < e; ++i)
 		{
-			mul128(&top[x], &bottom[y], &products[3 - x][y]);
+			mul256(&result, base, &tmp);
+			copy256(&result, &tmp);
 		}
+		copy256(target, &result);
+		return;
 	}
 
-	UPPER(fourth64) = 0;
-	LOWER(fourth64) = LOWER(products[0][3]);
-	UPPER(tmp) = 0;
-	LOWER(tmp) = LOWER(products[0][2]);
-	UPPER(tmp2) = 0;
-	LOWER(tmp2) = UPPER(products[0][3]);
-	add128(&tmp, &tmp2, &third64);
-	UPPER(tmp) = 0;
-	LOWER(tmp) = LOWER(products[0][1]);
-	UPPER(tmp2) = 0;
-	LOWER(tmp2) = UPPER(products[0][2]);
-	add128(&tmp, &tmp2, &second64);
-	UPPER(tmp) = 0;
-	LOWER(tmp) = LOWER(products[0][0]);
-	UPPER(tmp2) = 0;
-	LOWER(tmp2) = UPPER(products[0][1]);
-	add128(&tmp, &tmp2, &first64);
-
-	UPPER(tmp) = 0;
-	LOWER(tmp) = LOWER(products[1][3]);
-	add128(&tmp, &third64, &tmp2);
-	copy128(&third64, &tmp2);
-	UPPER(tmp) = 0;
-	LOWER(tmp) = LOWER(products[1][2]);
-	add128(&tmp, &second64, &tmp2);
-	UPPER(tmp) = 0;
-	LOWER(tmp) = UPPER(products[1][3]);
-	add128(&tmp, &tmp2, &second64);
-	UPPER(tmp) = 0;
-	LOWER(tmp) = LOWER(products[1][1]);
-	add128(&tmp, &first64, &tmp2);
-	UPPER(tmp) = 0;
-	LOWER(tmp) = UPPER(products[1][2]);
-	add128(&tmp, &tmp2, &first64);
-
-	UPPER(tmp) = 0;
-	LOWER(tmp) = LOWER(products[2][3]);
-	add128(&tmp, &second64, &tmp2);
-	copy128(&second64, &tmp2);
-	UPPER(tmp) = 0;
-	LOWER(tmp) = LOWER(products[2][2]);
-	add128(&tmp, &first64, &tmp2);
-	UPPER(tmp) = 0;
-	LOWER(tmp) = UPPER(products[2][3]);
-	add128(&tmp, &tmp2, &first64);
-
-	UPPER(tmp) = 0;
-	LOWER(tmp) = LOWER(products[3][3]);
-	add128(&tmp, &first64, &tmp2);
-	copy128(&first64, &tmp2);
-
-	clear256(&target1);
-	shiftl128(&first64, 64, &UPPER(target1));
-	clear256(&target2);
-	UPPER(UPPER(target2)) = UPPER(third64);
-	shiftl128(&third64, 64, &LOWER(target2));
-	add256(&target1, &target2, target);
-	clear256(&target1);
-	copy128(&UPPER(target1), &second64);
-	add256(&target1, target, &target2);
-	clear256(&target1);
-	copy128(&LOWER(target1), &fourth64);
-	add256(&target1, &target2, target);
+	// Left-to-right binary exponentiation: at most 2 * bits256(exponent) multiplications.
+	copy256(&result, base);
+	for (int32_t i = (int32_t)bits256(exponent) - 2; i >= 0; --i)
+	{
+		mul256(&result, &result, &tmp);
+		copy256(&result, &tmp);
+		if (bit256(exponent, (uint32_t)i))
+		{
+			mul256(&result, base, &tmp);
+			copy256(&result, &tmp);
+		}
+	}
+	copy256(target, &result);
 }
 
 void divmod128(struct uint128_t *l, struct uint128_t *r, struct uint128_t *retDiv,
@@ -561,44 +512,268 @@ void divmod128(struct uint128_t *l, struct uint128_t *r, struct uint128_t *retDi
 	}
 }
 
-void divmod256(struct uint256_t *l, struct uint256_t *r, struct uint256_t *retDiv,
-			   struct uint256_t *retMod)
+/// Möller–Granlund reciprocal of a normalized divisor: floor((2^128 - 1) / d) - 2^64.
+static uint64_t reciprocal_2by1(uint64_t d)
 {
-	struct uint256_t copyd, adder, resDiv, resMod;
-	struct uint256_t one;
-	clear256(&one);
-	UPPER(LOWER(one)) = 0;
-	LOWER(LOWER(one)) = 1;
-	uint32_t diffBits = bits256(l) - bits256(r);
-	clear256(&resDiv);
-	copy256(&resMod, l);
-	if (gt256(r, l))
+#ifdef __SIZEOF_INT128__
+	return (uint64_t)((((unsigned __int128)~d << 64) | ~(uint64_t)0) / d);
+#else
+	// Bitwise long division of (~d, ~0) by d. Done once per division only.
+	uint64_t high = ~d;
+	uint64_t low = ~(uint64_t)0;
+	uint64_t q = 0;
+	for (int i = 0; i < 64; ++i)
 	{
-		copy256(retMod, l);
-		clear256(retDiv);
+		uint64_t top = high >> 63;
+		high = (high << 1) | (low >> 63);
+		low <<= 1;
+		q <<= 1;
+		if (top || high >= d)
+		{
+			high -= d;
+			q |= 1;
+		}
 	}
-	else
+	return q;
+#endif
+}
+
+/// Divides (u1, u0) by the normalized d using its reciprocal v. Requires u1 < d.
+static uint64_t udivrem_2by1(uint64_t u1, uint64_t u0, uint64_t d, uint64_t v, uint64_t *rem)
+{
+	uint64_t qh, carry = 0;
+	uint64_t ql = umul(v, u1, &qh);
+	ql = addc(ql, u0, &carry);
+	qh = qh + u1 + carry + 1;
+
+	uint64_t r = u0 - qh * d;
+	if (r > ql)
+	{
+		--qh;
+		r += d;
+	}
+	if (r >= d)
+	{
+		++qh;
+		r -= d;
+	}
+	*rem = r;
+	return qh;
+}
+
+/// Word based long division of u[0..ulen) by v[0..vlen), least significant word first.
+/// This is Knuth's algorithm D with the quotient digits estimated by udivrem_2by1().
+/// The divisor must not be zero; q gets ulen words and r gets vlen words.
+static void udivrem(const uint64_t *u, int ulen, const uint64_t *v, int vlen, uint64_t *q, uint64_t *r)
+{
+	uint64_t un[9];
+	uint64_t vn[4];
+	int m = ulen;
+	int n = vlen;
+	while (m > 0 && u[m - 1] == 0)
+		--m;
+	while (n > 0 && v[n - 1] == 0)
+		--n;
+
+	for (int i = 0; i < ulen; ++i)
+		q[i] = 0;
+	for (int i = 0; i < vlen; ++i)
+		r[i] = 0;
+
+	if (m < n)
+	{
+		for (int i = 0; i < m; ++i)
+			r[i] = u[i];
+		return;
+	}
+
+	// Normalize so that the top bit of the divisor is set.
+	uint32_t shift = (uint32_t)__builtin_clzll(v[n - 1]);
+	for (int i = n - 1; i > 0; --i)
+		vn[i] = (v[i] << shift) | ((v[i - 1] >> 1) >> (63 - shift));
+	vn[0] = v[0] << shift;
+	un[m] = (u[m - 1] >> 1) >> (63 - shift);
+	for (int i = m - 1; i > 0; --i)
+		un[i] = (u[i] << shift) | ((u[i - 1] >> 1) >> (63 - shift));
+	un[0] = u[0] << shift;
+
+	uint64_t d1 = vn[n - 1];
+	uint64_t reciprocal = reciprocal_2by1(d1);
+
+	if (n == 1)
+	{
+		// Single word divisor: one 2by1 division per numerator word.
+		uint64_t rem = un[m];
+		for (int j = m - 1; j >= 0; --j)
+			q[j] = udivrem_2by1(rem, un[j], d1, reciprocal, &rem);
+		r[0] = rem >> shift;
+		return;
+	}
+
+	uint64_t d0 = vn[n - 2];
+	for (int j = m - n; j >= 0; --j)
 	{
-		shiftl256(r, diffBits, &copyd);
-		shiftl256(&one, diffBits, &adder);
-		if (gt256(&copyd, &resMod))
+		// Estimate the quotient digit from the top two words, then refine it with the third.
+		uint64_t qhat, rhat;
+		bool rhat_overflow = false;
+		if (un[j + n] == d1)
 		{
-			shiftr256(&copyd, 1, &copyd);
-			shiftr256(&adder, 1, &adder);
+			qhat = ~(uint64_t)0;
+			rhat = un[j + n - 1] + d1;
+			rhat_overflow = rhat < d1;
 		}
-		while (gte256(&resMod, r))
+		else
+			qhat = udivrem_2by1(un[j + n], un[j + n - 1], d1, reciprocal, &rhat);
+
+		while (!rhat_overflow)
 		{
-			if (gte256(&resMod, &copyd))
-			{
-				minus256(&resMod, &copyd, &resMod);
-				or256(&resDiv, &adder, &resDiv);
-			}
-			shiftr256(&copyd, 1, &copyd);
-			shiftr256(&adder, 1, &adder);
+			uint64_t ph;
+			uint64_t pl = umul(qhat, d0, &ph);
+			if (ph < rhat || (ph == rhat && pl <= un[j + n - 2]))
+				break;
+			--qhat;
+			rhat += d1;
+			rhat_overflow = rhat < d1;
+		}
+
+		// Multiply and subtract.
+		uint64_t carry = 0, borrow = 0;
+		for (int i = 0; i < n; ++i)
+		{
+			uint64_t ph;
+			uint64_t pl = umul(qhat, vn[i], &ph);
+			pl += carry;
+			carry = ph + (pl < carry);
+			un[i + j] = subb(un[i + j], pl, &borrow);
 		}
-		copy256(retDiv, &resDiv);
-		copy256(retMod, &resMod);
+		un[j + n] = subb(un[j + n], carry, &borrow);
+
+		// The estimate was one too large: add the divisor back.
+		if (borrow)
+		{
+			--qhat;
+			uint64_t c = 0;
+			for (int i = 0; i < n; ++i)
+				un[i + j] = addc(un[i + j], vn[i], &c);
+			un[j + n] += c;
+		}
+		q[j] = qhat;
+	}
+
+	for (int i = 0; i < n - 1; ++i)
+		r[i] = (un[i] >> shift) | ((un[i + 1] << 1) << (63 - shift));
+	r[n - 1] = un[n - 1] >> shift;
+}
+
+void divmod256(struct uint256_t *l, struct uint256_t *r, struct uint256_t *retDiv,
+			   struct uint256_t *retMod)
+{
+	struct uint256_t quotient = {0, 0, 0, 0};
+	struct uint256_t remainder = {0, 0, 0, 0};
+
+	if (zero256(r))
+	{
+		*retDiv = quotient;
+		*retMod = remainder;
+		return;
+	}
+
+	// Both operands fit in a word.
+	if ((WORD_P(l, 3) | WORD_P(l, 2) | WORD_P(l, 1) | WORD_P(r, 3) | WORD_P(r, 2) | WORD_P(r, 1)) == 0)
+	{
+		WORD(quotient, 0) = WORD_P(l, 0) / WORD_P(r, 0);
+		WORD(remainder, 0) = WORD_P(l, 0) % WORD_P(r, 0);
+		*retDiv = quotient;
+		*retMod = remainder;
+		return;
+	}
+
+	// Power of two divisor, e.g. the selector extraction of old Solidity dispatchers.
+	struct uint256_t one = {0, 0, 0, 1};
+	struct uint256_t mask;
+	minus256(r, &one, &mask);
+	struct uint256_t common;
+	and256(r, &mask, &common);
+	if (zero256(&common))
+	{
+		and256(l, &mask, &remainder);
+		shiftr256(l, bits256(r) - 1, &quotient);
+		*retDiv = quotient;
+		*retMod = remainder;
+		return;
+	}
+
+	uint64_t u[4], v[4], q[4], rem[4];
+	for (int i = 0; i < 4; ++i)
+	{
+		u[i] = WORD_P(l, i);
+		v[i] = WORD_P(r, i);
+	}
+	udivrem(u, 4, v, 4, q, rem);
+	for (int i = 0; i < 4; ++i)
+	{
+		WORD_P(retDiv, i) = q[i];
+		WORD_P(retMod, i) = rem[i];
+	}
+}
+
+void addmod256(struct uint256_t *x, struct uint256_t *y, struct uint256_t *m, struct uint256_t *target)
+{
+	if (zero256(m))
+	{
+		clear256(target);
+		return;
+	}
+
+	// Common case: both operands already reduced, at most one subtraction is needed.
+	if (gt256(m, x) && gt256(m, y))
+	{
+		struct uint256_t sum, diff;
+		uint64_t carry = 0, borrow = 0;
+		for (int i = 0; i < 4; ++i)
+			WORD(sum, i) = addc(WORD_P(x, i), WORD_P(y, i), &carry);
+		for (int i = 0; i < 4; ++i)
+			WORD(diff, i) = subb(WORD(sum, i), WORD_P(m, i), &borrow);
+		// The 257-bit sum is >= m unless the subtraction borrowed past the carry word.
+		*target = (carry || !borrow) ? diff : sum;
+		return;
+	}
+
+	// The sum has up to 257 bits.
+	uint64_t u[5], v[4], q[5], rem[4];
+	uint64_t carry = 0;
+	for (int i = 0; i < 4; ++i)
+	{
+		u[i] = addc(WORD_P(x, i), WORD_P(y, i), &carry);
+		v[i] = WORD_P(m, i);
+	}
+	u[4] = carry;
+	udivrem(u, 5, v, 4, q, rem);
+	for (int i = 0; i < 4; ++i)
+		WORD_P(target, i) = rem[i];
+}
+
+void mulmod256(struct uint256_t *x, struct uint256_t *y, struct uint256_t *m, struct uint256_t *target)
+{
+	if (zero256(m))
+	{
+		clear256(target);
+		return;
+	}
+
+	// The full 512-bit product is reduced, nothing is truncated.
+	struct uint256_t high, low;
+	mulfull256(x, y, &high, &low);
+	uint64_t u[8], v[4], q[8], rem[4];
+	for (int i = 0; i < 4; ++i)
+	{
+		u[i] = WORD(low, i);
+		u[i + 4] = WORD(high, i);
+		v[i] = WORD_P(m, i);
 	}
+	udivrem(u, 8, v, 4, q, rem);
+	for (int i = 0; i < 4; ++i)
+		WORD_P(target, i) = rem[i];
 }
 
 static void reverseString(char *str, uint32_t length)
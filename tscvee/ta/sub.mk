@@ -1,3 +1,5 @@
+# include/aot_contracts.h, the contracts compiled ahead of time, is generated by the
+# `aot` target of the normal-world build.
 global-incdirs-y += include
 global-incdirs-y += stc
 srcs-y += tscvee_ta.c
@@ -98,10 +98,6 @@ static TEE_Result tscvee_main(uint32_t param_types,
     bool create = false;
     bool bench = bench_flag;
 
-	// Initialize instruction table
-    GasCostTable_init(gas_costs);
-    TraitsTable_init(traits);
-
 	// tscvee_run(vm, rev, gas, bytecode, input, create, bench);
 	IMSG("%s with %d gas limit\n", create ? "Creating and executing on " : "Executing on ", gas);
 
@@ -126,12 +122,20 @@ static TEE_Result tscvee_main(uint32_t param_types,
 		IMSG("Create.\n");
     }
     
+    MemoryPagePool_begin_execution(&memory_page_pool);
     struct evmc_result result = vm->execute(vm, host, rev, msg, code, code_size);
 
 	IMSG("Smart contract execution over.\n");
 
 	if(bench){
 		IMSG("Bench.\n");
+		IMSG("Analysis cache: %lu hits, %lu misses (%lu loaded), %lu evictions\n", (unsigned long)analysis_cache.hits,
+		     (unsigned long)analysis_cache.misses, (unsigned long)analysis_cache.loads,
+		     (unsigned long)analysis_cache.evictions);
+		IMSG("Memory pages: %lu peak, %lu heap peak, %lu idle (%lu allocations, %lu reuses, %lu in-place growths)\n",
+		     (unsigned long)memory_page_pool.peak_pages, (unsigned long)memory_page_pool.heap_peak_pages,
+		     (unsigned long)memory_page_pool.idle_pages, (unsigned long)memory_page_pool.allocations,
+		     (unsigned long)memory_page_pool.reuses, (unsigned long)memory_page_pool.in_place_growths);
     }
 
     int64_t gas_used = msg->gas - result.gas_left;